@@ -1154,6 +1154,64 @@ private:
   /// skipped.
   llvm::DenseMap<const char *, unsigned> RecordedSkippedRanges;
 
+  /// The fully preprocessed token stream of a header, recorded under
+  /// -fcache-header-tokens, together with the macro state it depends on.
+  struct CachedHeaderTokensInfo {
+    /// The tokens the header produced, after macro expansion.
+    ArrayRef<Token> Tokens;
+
+    /// Every (identifier, definition) pair observed while recording. The
+    /// stream may only be replayed while each identifier still resolves to
+    /// the same definition.
+    ArrayRef<std::pair<IdentifierInfo *, const MacroInfo *>> MacroDeps;
+  };
+
+  /// Token streams recorded for directive-free headers, keyed by file. See
+  /// replayOrRecordHeaderTokens().
+  llvm::DenseMap<const FileEntry *, CachedHeaderTokensInfo> HeaderTokenCache;
+
+  /// Owns the token and dependency arrays in HeaderTokenCache.
+  llvm::BumpPtrAllocator HeaderTokenCacheAlloc;
+
+  /// State for an in-progress header token recording. Non-null only between
+  /// entering an eligible header and either reaching its end of file or
+  /// hitting a construct that makes the stream unsafe to replay (any
+  /// directive, a builtin macro expansion, or a nested file entry).
+  struct HeaderTokenRecordingState {
+    const FileEntry *File = nullptr;
+    FileID FID;
+    SmallVector<Token, 64> Tokens;
+    SmallVector<std::pair<IdentifierInfo *, const MacroInfo *>, 16> MacroDeps;
+    llvm::SmallPtrSet<const IdentifierInfo *, 16> SeenIdents;
+  };
+  std::unique_ptr<HeaderTokenRecordingState> HeaderTokenRecording;
+
+  /// The TokenLexer currently replaying a cached header token stream, if any,
+  /// and the FileID of the inclusion being replayed. Tracked so the matching
+  /// ExitFile callbacks fire when the stream runs out (the EnterFile side is
+  /// fired when the replay starts).
+  TokenLexer *HeaderTokenReplayLexer = nullptr;
+  FileID HeaderTokenReplayFID;
+
+  /// Replay a previously recorded token stream for \p FID's file if one
+  /// exists and its macro dependencies are unchanged, or else start recording
+  /// one. Returns true if the stream was replayed, in which case the caller
+  /// must not enter the file.
+  bool replayOrRecordHeaderTokens(FileID FID);
+
+  /// Note that \p Tok was produced while a header recording is active.
+  void recordHeaderToken(const Token &Tok);
+
+  /// Record that the identifier \p II was seen while recording; the cached
+  /// stream becomes dependent on II's current (possibly null) definition.
+  void recordHeaderTokenMacroDep(IdentifierInfo *II);
+
+  /// Commit the in-progress recording to HeaderTokenCache.
+  void finishHeaderTokenRecording();
+
+  /// Drop an in-progress recording because an unsupported construct was seen.
+  void abortHeaderTokenRecording() { HeaderTokenRecording.reset(); }
+
   void updateOutOfDateIdentifier(IdentifierInfo &II) const;
 
 public:
@@ -152,6 +152,11 @@ public:
   /// When enabled, the preprocessor will construct editor placeholder tokens.
   bool LexEditorPlaceholders = true;
 
+  /// When enabled, cache the fully preprocessed token stream of headers that
+  /// contain no directives, and replay it when the same header is textually
+  /// re-included and every macro the stream depends on is unchanged.
+  bool CacheHeaderTokens = false;
+
   /// True if the SourceManager should report the original file name for
   /// contents of files that were remapped to other files. Defaults to true.
   bool RemappedFilesKeepOriginalName = true;
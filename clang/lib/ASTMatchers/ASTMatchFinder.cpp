@@ -1036,6 +1036,11 @@ private:
     const bool EnableCheckProfiling = Options.CheckProfiling.has_value();
     TimeBucketRegion Timer;
     auto &Matchers = this->Matchers->DeclOrStmt;
+    // Whether this node is skipped under a given traversal kind depends only
+    // on the kind, not on the matcher. Cache the verdict per kind so large
+    // matcher sets do not recompute it for every matcher at every node.
+    // Index 0 is "no explicit kind"; the rest are 1 + TraversalKind.
+    std::optional<bool> IgnoredByKind[3];
     for (unsigned short I : Filter) {
       auto &MP = Matchers[I];
       if (EnableCheckProfiling)
@@ -1043,9 +1048,16 @@ private:
       BoundNodesTreeBuilder Builder;
 
       {
-        TraversalKindScope RAII(getASTContext(), MP.first.getTraversalKind());
-        if (getASTContext().getParentMapContext().traverseIgnored(DynNode) !=
-            DynNode)
+        std::optional<TraversalKind> TK = MP.first.getTraversalKind();
+        unsigned KindIdx = TK ? 1 + *TK : 0;
+        assert(KindIdx < std::size(IgnoredByKind) && "unexpected kind");
+        if (!IgnoredByKind[KindIdx]) {
+          TraversalKindScope RAII(getASTContext(), TK);
+          IgnoredByKind[KindIdx] =
+              getASTContext().getParentMapContext().traverseIgnored(DynNode) !=
+              DynNode;
+        }
+        if (*IgnoredByKind[KindIdx])
           continue;
       }
 
@@ -1257,6 +1257,12 @@ unsigned SourceManager::getPresumedColumnNumber(SourceLocation Loc,
   return PLoc.getColumn();
 }
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 // Check if mutli-byte word x has bytes between m and n, included. This may also
 // catch bytes equal to n + 1.
 // The returned value holds a 0x80 at each byte position that holds a match.
@@ -1284,6 +1290,54 @@ LineOffsetMapping LineOffsetMapping::get(llvm::MemoryBufferRef Buffer,
   const unsigned char *End = (const unsigned char *)Buffer.getBufferEnd();
   const unsigned char *Buf = Start;
 
+#ifdef __SSE2__
+  // Scan 16 bytes at a time for new lines. Chunks without any vertical
+  // whitespace are skipped with a single compare, which is where nearly all of
+  // the time goes on typical source files.
+  if ((unsigned long)(End - Start) > 16) {
+    const __m128i CRs = _mm_set1_epi8('\r');
+    const __m128i LFs = _mm_set1_epi8('\n');
+    do {
+      __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Buf));
+      unsigned Mask = _mm_movemask_epi8(_mm_or_si128(
+          _mm_cmpeq_epi8(Chunk, CRs), _mm_cmpeq_epi8(Chunk, LFs)));
+      // No new line => jump over the whole chunk.
+      if (!Mask) {
+        Buf += 16;
+        continue;
+      }
+
+      Buf += llvm::countr_zero(Mask) + 1;
+      // If this is \r\n, skip both characters.
+      if (Buf[-1] == '\r' && *Buf == '\n')
+        ++Buf;
+      LineOffsets.push_back(Buf - Start);
+    } while (Buf < End - 16 - 1);
+  }
+#elif defined(__ARM_NEON)
+  if ((unsigned long)(End - Start) > 16) {
+    const uint8x16_t CRs = vdupq_n_u8('\r');
+    const uint8x16_t LFs = vdupq_n_u8('\n');
+    do {
+      uint8x16_t Chunk = vld1q_u8(Buf);
+      uint8x16_t IsNL = vorrq_u8(vceqq_u8(Chunk, CRs), vceqq_u8(Chunk, LFs));
+      // Narrow each 0x00/0xff match byte to a nibble of a 64-bit mask.
+      uint64_t Mask = vget_lane_u64(
+          vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(IsNL), 4)), 0);
+      // No new line => jump over the whole chunk.
+      if (!Mask) {
+        Buf += 16;
+        continue;
+      }
+
+      Buf += llvm::countr_zero(Mask) / 4 + 1;
+      // If this is \r\n, skip both characters.
+      if (Buf[-1] == '\r' && *Buf == '\n')
+        ++Buf;
+      LineOffsets.push_back(Buf - Start);
+    } while (Buf < End - 16 - 1);
+  }
+#else
   uint64_t Word;
 
   // scan sizeof(Word) bytes at a time for new lines.
@@ -1318,6 +1372,7 @@ LineOffsetMapping LineOffsetMapping::get(llvm::MemoryBufferRef Buffer,
       };
     } while (Buf < End - sizeof(Word) - 1);
   }
+#endif
 
   // Handle tail using a regular check.
   while (Buf < End) {
@@ -3015,10 +3015,14 @@ void CodeGenModule::EmitDeferred() {
 
   // Emit CUDA/HIP static device variables referenced by host code only.
   // Note we should not clear CUDADeviceVarODRUsedByHost since it is still
-  // needed for further handling.
+  // needed for further handling. EmitDeferred runs recursively, so only
+  // schedule variables that have not been scheduled by an earlier pass;
+  // re-appending the whole set would push every variable through the
+  // mangled-name and global lookups below once per pass.
   if (getLangOpts().CUDA && getLangOpts().CUDAIsDevice)
-    llvm::append_range(DeferredDeclsToEmit,
-                       getContext().CUDADeviceVarODRUsedByHost);
+    for (const VarDecl *VD : getContext().CUDADeviceVarODRUsedByHost)
+      if (ScheduledCUDADeviceVars.insert(VD).second)
+        DeferredDeclsToEmit.emplace_back(VD);
 
   // Stop if we're out of both deferred vtables and deferred declarations.
   if (DeferredDeclsToEmit.empty())
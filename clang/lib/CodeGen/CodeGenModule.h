@@ -360,6 +360,11 @@ private:
   /// Decls that were DeferredDecls and have now been emitted.
   llvm::DenseMap<llvm::StringRef, GlobalDecl> EmittedDeferredDecls;
 
+  /// CUDA device variables ODR-used by host code that have already been
+  /// scheduled for emission by EmitDeferred, so recursive passes only pick up
+  /// variables added since the last pass.
+  llvm::DenseSet<const VarDecl *> ScheduledCUDADeviceVars;
+
   void addEmittedDeferredDecl(GlobalDecl GD) {
     if (!llvm::isa<FunctionDecl>(GD.getDecl()))
       return;
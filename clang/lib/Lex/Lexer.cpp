@@ -2705,6 +2705,8 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr, Lexer *L,
 #elif __ALTIVEC__
 #include <altivec.h>
 #undef bool
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
 #endif
 
 /// We have just read from input the / and * characters that started a comment.
@@ -2808,6 +2810,33 @@ bool Lexer::SkipBlockComment(Token &Result, const char *CurPtr,
         CurPtr += 16;
       }
 
+#elif defined(__ARM_NEON)
+      uint8x16_t Slashes = vdupq_n_u8('/');
+      uint8x16_t HighBits = vdupq_n_u8(0x80);
+      while (CurPtr + 16 < BufferEnd) {
+        uint8x16_t Chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(CurPtr));
+        // Narrow each 0x00/0xff lane to a nibble of a 64-bit mask.
+        uint64_t NonASCII = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(
+                vreinterpretq_u16_u8(vtstq_u8(Chunk, HighBits)), 4)),
+            0);
+        if (LLVM_UNLIKELY(NonASCII != 0))
+          goto MultiByteUTF8;
+        // look for slashes
+        uint64_t Cmp = vget_lane_u64(
+            vreinterpret_u64_u8(vshrn_n_u16(
+                vreinterpretq_u16_u8(vceqq_u8(Chunk, Slashes)), 4)),
+            0);
+        if (Cmp != 0) {
+          // Adjust the pointer to point directly after the first slash. It's
+          // not necessary to set C here, it will be overwritten at the end of
+          // the outer loop.
+          CurPtr += llvm::countr_zero(Cmp) / 4 + 1;
+          goto FoundSlash;
+        }
+        CurPtr += 16;
+      }
+
 #else
       while (CurPtr + 16 < BufferEnd) {
         bool HasNonASCII = false;
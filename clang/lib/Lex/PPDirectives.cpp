@@ -1132,6 +1132,11 @@ void Preprocessor::HandleSkippedDirectiveWhileUsingPCH(Token &Result,
 void Preprocessor::HandleDirective(Token &Result) {
   // FIXME: Traditional: # with whitespace before it not recognized by K&R?
 
+  // Any directive makes the enclosing file ineligible for the header token
+  // cache; its effects would not be replayed with the stream.
+  if (LLVM_UNLIKELY(HeaderTokenRecording != nullptr))
+    abortHeaderTokenRecording();
+
   // We just parsed a # character at the start of a line, so we're in directive
   // mode.  Tell the lexer this so any newlines we see will be converted into an
   // EOD token (which terminates the directive).
@@ -92,6 +92,14 @@ bool Preprocessor::EnterSourceFile(FileID FID, ConstSearchDirIterator CurDir,
         CodeCompletionFileLoc.getLocWithOffset(CodeCompletionOffset);
   }
 
+  // Under -fcache-header-tokens, try to replay a previously recorded token
+  // stream for this file instead of lexing it again.
+  if (getPreprocessorOpts().CacheHeaderTokens && FID != PredefinesFileID &&
+      !isCodeCompletionEnabled() && !getLangOpts().Modules &&
+      !getPreprocessorOpts().DependencyDirectivesForFile)
+    if (replayOrRecordHeaderTokens(FID))
+      return false;
+
   Lexer *TheLexer = new Lexer(FID, *InputFile, *this, IsFirstIncludeOfFile);
   if (getPreprocessorOpts().DependencyDirectivesForFile &&
       FID != PredefinesFileID) {
@@ -108,6 +116,90 @@ bool Preprocessor::EnterSourceFile(FileID FID, ConstSearchDirIterator CurDir,
   return false;
 }
 
+bool Preprocessor::replayOrRecordHeaderTokens(FileID FID) {
+  // A nested file entry ends any recording in flight; the enclosing file saw
+  // an #include directive, which already made it ineligible.
+  abortHeaderTokenRecording();
+
+  const FileEntry *FE = SourceMgr.getFileEntryForID(FID);
+  if (!FE || FID == SourceMgr.getMainFileID())
+    return false;
+
+  auto It = HeaderTokenCache.find(FE);
+  if (It != HeaderTokenCache.end()) {
+    // The recorded stream is fully expanded, so it may only be replayed while
+    // every identifier it depends on still resolves to the definition it had
+    // when the stream was recorded.
+    bool Usable = llvm::all_of(It->second.MacroDeps, [&](const auto &Dep) {
+      return getMacroInfo(Dep.first) == Dep.second;
+    });
+    if (Usable) {
+      // Fire the same file-transition callbacks a real lexer entry would, so
+      // clients observing inclusions (dependency scanners, -E line markers,
+      // -H) see a stream indistinguishable from an actual re-lex. The
+      // matching ExitFile side fires in HandleEndOfTokenLexer when the
+      // replayed stream runs out.
+      if (Callbacks) {
+        SourceLocation FileStart = SourceMgr.getLocForStartOfFile(FID);
+        SrcMgr::CharacteristicKind FileType =
+            SourceMgr.getFileCharacteristic(FileStart);
+        FileID PrevFID;
+        SourceLocation EnterLoc;
+        if (CurPPLexer) {
+          PrevFID = CurPPLexer->getFileID();
+          EnterLoc = CurPPLexer->getSourceLocation();
+        }
+        Callbacks->FileChanged(FileStart, PPCallbacks::EnterFile, FileType,
+                               PrevFID);
+        Callbacks->LexedFileChanged(
+            FID, PPCallbacks::LexedFileChangeReason::EnterFile, FileType,
+            PrevFID, EnterLoc);
+      }
+      EnterTokenStream(It->second.Tokens, /*DisableMacroExpansion=*/true,
+                       /*IsReinject=*/false);
+      HeaderTokenReplayLexer = CurTokenLexer.get();
+      HeaderTokenReplayFID = FID;
+      return true;
+    }
+    // The macro context changed; drop the stale stream and re-record below so
+    // repeated inclusions under the new context can hit the cache again.
+    HeaderTokenCache.erase(It);
+  }
+
+  HeaderTokenRecording = std::make_unique<HeaderTokenRecordingState>();
+  HeaderTokenRecording->File = FE;
+  HeaderTokenRecording->FID = FID;
+  return false;
+}
+
+void Preprocessor::recordHeaderToken(const Token &Tok) {
+  assert(HeaderTokenRecording && "no header token recording in progress");
+  HeaderTokenRecording->Tokens.push_back(Tok);
+}
+
+void Preprocessor::recordHeaderTokenMacroDep(IdentifierInfo *II) {
+  assert(HeaderTokenRecording && "no header token recording in progress");
+  if (HeaderTokenRecording->SeenIdents.insert(II).second)
+    HeaderTokenRecording->MacroDeps.push_back({II, getMacroInfo(II)});
+}
+
+void Preprocessor::finishHeaderTokenRecording() {
+  assert(HeaderTokenRecording && "no header token recording in progress");
+  HeaderTokenRecordingState &R = *HeaderTokenRecording;
+  if (!R.Tokens.empty()) {
+    CachedHeaderTokensInfo &Info = HeaderTokenCache[R.File];
+    Token *Toks = HeaderTokenCacheAlloc.Allocate<Token>(R.Tokens.size());
+    std::uninitialized_copy(R.Tokens.begin(), R.Tokens.end(), Toks);
+    Info.Tokens = ArrayRef<Token>(Toks, R.Tokens.size());
+    auto *Deps = HeaderTokenCacheAlloc
+                     .Allocate<std::pair<IdentifierInfo *, const MacroInfo *>>(
+                         R.MacroDeps.size());
+    std::uninitialized_copy(R.MacroDeps.begin(), R.MacroDeps.end(), Deps);
+    Info.MacroDeps = ArrayRef(Deps, R.MacroDeps.size());
+  }
+  HeaderTokenRecording.reset();
+}
+
 /// EnterSourceFileWithLexer - Add a source file to the top of the include stack
 ///  and start lexing tokens from it instead of the current buffer.
 void Preprocessor::EnterSourceFileWithLexer(Lexer *TheLexer,
@@ -333,6 +425,15 @@ bool Preprocessor::HandleEndOfFile(Token &Result, bool isEndOfMacro) {
   assert(!CurTokenLexer &&
          "Ending a file when currently in a macro!");
 
+  // If we reached the end of the file being recorded for the header token
+  // cache without hitting an unsupported construct, commit the recording.
+  if (LLVM_UNLIKELY(HeaderTokenRecording != nullptr) && !isEndOfMacro) {
+    if (CurPPLexer && CurPPLexer->getFileID() == HeaderTokenRecording->FID)
+      finishHeaderTokenRecording();
+    else
+      abortHeaderTokenRecording();
+  }
+
   SourceLocation UnclosedSafeBufferOptOutLoc;
 
   if (IncludeMacroStack.empty() &&
@@ -607,6 +708,17 @@ bool Preprocessor::HandleEndOfTokenLexer(Token &Result) {
       MacroExpandingLexersStack.back().first == CurTokenLexer.get())
     removeCachedMacroExpandedTokensOfLastLexer();
 
+  // If this lexer was replaying a cached header token stream, its end is the
+  // point where the "file" is exited; note the FileID so the ExitFile
+  // callbacks matching the EnterFile ones fired at replay start can be run
+  // once the stack is popped below.
+  FileID ReplayedFID;
+  if (CurTokenLexer.get() == HeaderTokenReplayLexer) {
+    ReplayedFID = HeaderTokenReplayFID;
+    HeaderTokenReplayLexer = nullptr;
+    HeaderTokenReplayFID = FileID();
+  }
+
   // Delete or cache the now-dead macro expander.
   if (NumCachedTokenLexers == TokenLexerCacheSize)
     CurTokenLexer.reset();
@@ -614,7 +726,17 @@ bool Preprocessor::HandleEndOfTokenLexer(Token &Result) {
     TokenLexerCache[NumCachedTokenLexers++] = std::move(CurTokenLexer);
 
   // Handle this like a #include file being popped off the stack.
-  return HandleEndOfFile(Result, true);
+  bool Done = HandleEndOfFile(Result, true);
+
+  if (ReplayedFID.isValid() && Callbacks && CurPPLexer) {
+    SourceLocation Loc = CurPPLexer->getSourceLocation();
+    SrcMgr::CharacteristicKind FileType = SourceMgr.getFileCharacteristic(Loc);
+    Callbacks->FileChanged(Loc, PPCallbacks::ExitFile, FileType, ReplayedFID);
+    Callbacks->LexedFileChanged(CurPPLexer->getFileID(),
+                                PPCallbacks::LexedFileChangeReason::ExitFile,
+                                FileType, ReplayedFID, Loc);
+  }
+  return Done;
 }
 
 /// RemoveTopOfLexerStack - Pop the current lexer/macro exp off the top of the
@@ -624,6 +746,13 @@ void Preprocessor::RemoveTopOfLexerStack() {
   assert(!IncludeMacroStack.empty() && "Ran out of stack entries to load");
 
   if (CurTokenLexer) {
+    // This error path discards the lexer without the usual end-of-stream
+    // handling; make sure a dying header token replay is not left tracked.
+    if (CurTokenLexer.get() == HeaderTokenReplayLexer) {
+      HeaderTokenReplayLexer = nullptr;
+      HeaderTokenReplayFID = FileID();
+    }
+
     // Delete or cache the now-dead macro expander.
     if (NumCachedTokenLexers == TokenLexerCacheSize)
       CurTokenLexer.reset();
@@ -1491,6 +1491,12 @@ static bool isTargetVariantEnvironment(const TargetInfo &TI,
 /// ExpandBuiltinMacro - If an identifier token is read that is to be expanded
 /// as a builtin macro, handle it and return the next token as 'Tok'.
 void Preprocessor::ExpandBuiltinMacro(Token &Tok) {
+  // Builtin macros (__LINE__, __COUNTER__, _Pragma, ...) expand depending on
+  // position or mutable state, so their expansion cannot be replayed from the
+  // header token cache.
+  if (LLVM_UNLIKELY(HeaderTokenRecording != nullptr))
+    abortHeaderTokenRecording();
+
   // Figure out which token this is.
   IdentifierInfo *II = Tok.getIdentifierInfo();
   assert(II && "Can't be a macro without id info!");
@@ -788,6 +788,11 @@ bool Preprocessor::HandleIdentifier(Token &Identifier) {
 
   IdentifierInfo &II = *Identifier.getIdentifierInfo();
 
+  // Identifiers that are about to be expanded never reach the end of Lex(), so
+  // record them as header token cache dependencies here.
+  if (LLVM_UNLIKELY(HeaderTokenRecording != nullptr))
+    recordHeaderTokenMacroDep(&II);
+
   // If the information about this identifier is out of date, update it from
   // the external source.
   // We have to treat __VA_ARGS__ in a special way, since it gets
@@ -986,6 +991,17 @@ void Preprocessor::Lex(Token &Result) {
   LastTokenWasAt = Result.is(tok::at);
   --LexLevel;
 
+  if (LLVM_UNLIKELY(HeaderTokenRecording != nullptr) &&
+      !Result.getFlag(Token::IsReinjected)) {
+    // Every identifier that surfaces here is a macro dependency of the stream
+    // being recorded, whether it comes from the header itself, a macro body,
+    // or a macro argument. Only top-level tokens form the replayable stream.
+    if (IdentifierInfo *II = Result.getIdentifierInfo())
+      recordHeaderTokenMacroDep(II);
+    if (LexLevel == 0)
+      recordHeaderToken(Result);
+  }
+
   if ((LexLevel == 0 || PreprocessToken) &&
       !Result.getFlag(Token::IsReinjected)) {
     if (LexLevel == 0)
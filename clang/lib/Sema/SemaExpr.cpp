@@ -18977,11 +18977,16 @@ void Sema::MarkFunctionReferenced(SourceLocation Loc, FunctionDecl *Func,
               CodeSynthesisContexts.size())
             PendingLocalImplicitInstantiations.push_back(
                 std::make_pair(Func, PointOfInstantiation));
-          else if (Func->isConstexpr())
+          else if (Func->isConstexpr()) {
             // Do not defer instantiations of constexpr functions, to avoid the
             // expression evaluator needing to call back into Sema if it sees a
-            // call to such a function.
-            InstantiateFunctionDefinition(PointOfInstantiation, Func);
+            // call to such a function. Once the body has been materialized
+            // there is nothing left to do; constexpr functions take this path
+            // on every reference, so skip re-entering the instantiation
+            // machinery just to discover the existing definition.
+            if (!Func->isDefined())
+              InstantiateFunctionDefinition(PointOfInstantiation, Func);
+          }
           else {
             Func->setInstantiationIsPending(true);
             PendingInstantiations.push_back(
@@ -6365,6 +6365,12 @@ void Sema::PerformPendingInstantiations(bool LocalOnly) {
 
     // Instantiate function definitions
     if (FunctionDecl *Function = dyn_cast<FunctionDecl>(Inst.first)) {
+      // The queue can hold duplicate entries for one specialization, e.g. when
+      // a constexpr function that could not be instantiated at its first point
+      // of use is re-queued. Skip entries an earlier pass already satisfied.
+      if (!Function->instantiationIsPending() && Function->isDefined())
+        continue;
+
       bool DefinitionRequired = Function->getTemplateSpecializationKind() ==
                                 TSK_ExplicitInstantiationDefinition;
       if (Function->isMultiVersion()) {
@@ -15,6 +15,7 @@
 #include "clang/Basic/FileManager.h"
 #include "clang/Basic/LLVM.h"
 #include "clang/Lex/HeaderSearch.h"
+#include "clang/Lex/HeaderSearchOptions.h"
 #include "clang/Lex/ModuleMap.h"
 #include "clang/Serialization/GlobalModuleIndex.h"
 #include "clang/Serialization/InMemoryModuleCache.h"
@@ -207,10 +208,23 @@ ModuleManager::addModule(StringRef FileName, ModuleKind Type,
       // The file is volatile because in a parallel build we expect multiple
       // compiler processes to use the same module file rebuilding it if needed.
       //
+      // However, when validating once per build session, an implicit PCM whose
+      // timestamp file shows it was already validated this session will not be
+      // rebuilt for the remainder of the session. Mapping it shared instead of
+      // making a private in-memory copy lets every compile process of a large
+      // parallel build share the same page-cache pages for the module cache.
+      const HeaderSearchOptions &HSOpts =
+          HeaderSearchInfo.getHeaderSearchOpts();
+      bool IsStable =
+          NewModule->Kind == MK_ImplicitModule &&
+          HSOpts.ModulesValidateOncePerBuildSession &&
+          NewModule->InputFilesValidationTimestamp >=
+              static_cast<time_t>(HSOpts.BuildSessionTimestamp);
+
       // RequiresNullTerminator is false because module files don't need it, and
       // this allows the file to still be mmapped.
       Buf = FileMgr.getBufferForFile(NewModule->File,
-                                     /*IsVolatile=*/true,
+                                     /*IsVolatile=*/!IsStable,
                                      /*RequiresNullTerminator=*/false);
     }
 
@@ -21,10 +21,14 @@
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/Allocator.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/Chrono.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/ErrorOr.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/StringSaver.h"
 #include "llvm/Support/VirtualFileSystem.h"
 #include "llvm/Support/YAMLParser.h"
@@ -156,6 +160,270 @@ std::vector<std::string> unescapeCommandLine(JSONCommandLineSyntax Syntax,
   return parser.parse();
 }
 
+// A compilation database read back from a binary sidecar that an earlier run
+// produced from compile_commands.json (see writeBinarySidecar below). The
+// sidecar stores string-deduplicated, fully unescaped command records, so
+// loading it is a bounds-checked scan of a memory-mapped buffer instead of a
+// YAML parse; all strings are served directly out of the mapping.
+//
+// Layout (all integers little-endian):
+//   u8[4]  magic "CCDB"
+//   u32    format version
+//   u64    size of the compile_commands.json it was produced from
+//   u64    mtime of the compile_commands.json it was produced from
+//   u32    number of commands
+//   u32    number of strings
+//   u64    offset of the string table
+//   command records: u32 directory, u32 filename, u32 output,
+//                    u32 argument count, u32 per argument (string indices)
+//   string table: u32 length per string, then the concatenated bytes
+class BinaryCompilationDatabase : public CompilationDatabase {
+public:
+  static constexpr char Magic[4] = {'C', 'C', 'D', 'B'};
+  static constexpr uint32_t FormatVersion = 1;
+  static constexpr size_t HeaderSize = 40;
+
+  /// Load the sidecar at \p CachePath if it exists and was produced from the
+  /// compile_commands.json described by \p JSONStatus; returns null (and never
+  /// an error) otherwise, in which case the caller falls back to the JSON.
+  static std::unique_ptr<BinaryCompilationDatabase>
+  loadIfValid(StringRef CachePath, const llvm::sys::fs::file_status &JSONStatus) {
+    auto Buffer = llvm::MemoryBuffer::getFile(CachePath, /*IsText=*/false,
+                                              /*RequiresNullTerminator=*/false);
+    if (!Buffer)
+      return nullptr;
+    StringRef Data = (*Buffer)->getBuffer();
+    if (Data.size() < HeaderSize || !Data.starts_with(StringRef(Magic, 4)))
+      return nullptr;
+    using namespace llvm::support::endian;
+    const char *P = Data.data();
+    if (read32le(P + 4) != FormatVersion)
+      return nullptr;
+    // Mtime-based invalidation: the sidecar only describes the exact JSON it
+    // was produced from.
+    if (read64le(P + 8) != JSONStatus.getSize() ||
+        read64le(P + 16) != (uint64_t)llvm::sys::toTimeT(
+                                JSONStatus.getLastModificationTime()))
+      return nullptr;
+    std::unique_ptr<BinaryCompilationDatabase> DB(
+        new BinaryCompilationDatabase(std::move(*Buffer)));
+    if (!DB->parse())
+      return nullptr;
+    return DB;
+  }
+
+  std::vector<CompileCommand>
+  getCompileCommands(StringRef FilePath) const override {
+    SmallString<128> NativeFilePath;
+    llvm::sys::path::native(FilePath, NativeFilePath);
+
+    std::string Error;
+    llvm::raw_string_ostream ES(Error);
+    StringRef Match = MatchTrie.findEquivalent(NativeFilePath, ES);
+    if (Match.empty())
+      return {};
+    const auto CommandsI = IndexByFile.find(Match);
+    if (CommandsI == IndexByFile.end())
+      return {};
+    std::vector<CompileCommand> Commands;
+    for (uint32_t I : CommandsI->getValue())
+      materialize(I, Commands);
+    return Commands;
+  }
+
+  std::vector<std::string> getAllFiles() const override {
+    std::vector<std::string> Result;
+    for (const auto &CommandsRef : IndexByFile)
+      Result.push_back(CommandsRef.first().str());
+    return Result;
+  }
+
+  std::vector<CompileCommand> getAllCompileCommands() const override {
+    std::vector<CompileCommand> Commands;
+    for (uint32_t I = 0, E = Records.size(); I != E; ++I)
+      materialize(I, Commands);
+    return Commands;
+  }
+
+private:
+  struct CommandRecord {
+    uint32_t Directory;
+    uint32_t Filename;
+    uint32_t Output;
+    uint32_t ArgStart;
+    uint32_t NumArgs;
+  };
+
+  explicit BinaryCompilationDatabase(std::unique_ptr<llvm::MemoryBuffer> Buffer)
+      : Buffer(std::move(Buffer)) {}
+
+  // Deserialize the buffer, rejecting anything out of bounds. Returns false
+  // on any inconsistency; a truncated or corrupt sidecar must never be
+  // trusted over re-parsing the JSON.
+  bool parse() {
+    using namespace llvm::support::endian;
+    StringRef Data = Buffer->getBuffer();
+    const char *P = Data.data();
+    uint32_t NumCommands = read32le(P + 24);
+    uint32_t NumStrings = read32le(P + 28);
+    uint64_t StringTableOffset = read64le(P + 32);
+    if (StringTableOffset < HeaderSize || StringTableOffset > Data.size())
+      return false;
+
+    // String table: length array followed by the concatenated bytes.
+    if (Data.size() - StringTableOffset < (uint64_t)NumStrings * 4)
+      return false;
+    const char *LengthsP = P + StringTableOffset;
+    const char *BytesP = LengthsP + (uint64_t)NumStrings * 4;
+    uint64_t BytesLeft = Data.size() - (BytesP - P);
+    Strings.reserve(NumStrings);
+    for (uint32_t I = 0; I != NumStrings; ++I) {
+      uint32_t Length = read32le(LengthsP + (uint64_t)I * 4);
+      if (Length > BytesLeft)
+        return false;
+      Strings.push_back(StringRef(BytesP, Length));
+      BytesP += Length;
+      BytesLeft -= Length;
+    }
+
+    // Command records. Each record is at least four u32s, so a well-formed
+    // sidecar cannot hold more than RecordBytes / 16 of them; reject a larger
+    // count up front rather than letting it drive the reserve below (the
+    // string lengths bound NumStrings the same way above).
+    const char *RecordP = P + HeaderSize;
+    uint64_t RecordBytes = StringTableOffset - HeaderSize;
+    if (NumCommands > RecordBytes / 16)
+      return false;
+    Records.reserve(NumCommands);
+    auto ReadIndex = [&](uint32_t &Out) {
+      if (RecordBytes < 4)
+        return false;
+      Out = read32le(RecordP);
+      RecordP += 4;
+      RecordBytes -= 4;
+      return Out < Strings.size();
+    };
+    for (uint32_t I = 0; I != NumCommands; ++I) {
+      CommandRecord Record;
+      Record.ArgStart = Args.size();
+      uint32_t NumArgs;
+      if (!ReadIndex(Record.Directory) || !ReadIndex(Record.Filename) ||
+          !ReadIndex(Record.Output))
+        return false;
+      if (RecordBytes < 4)
+        return false;
+      NumArgs = read32le(RecordP);
+      RecordP += 4;
+      RecordBytes -= 4;
+      for (uint32_t A = 0; A != NumArgs; ++A) {
+        uint32_t Arg;
+        if (!ReadIndex(Arg))
+          return false;
+        Args.push_back(Arg);
+      }
+      Record.NumArgs = NumArgs;
+      Records.push_back(Record);
+
+      // Index the record under the same native path key the JSON database
+      // would have used.
+      StringRef Filename = Strings[Record.Filename];
+      SmallString<128> NativeFilePath;
+      if (llvm::sys::path::is_relative(Filename)) {
+        SmallString<128> AbsolutePath(Strings[Record.Directory]);
+        llvm::sys::path::append(AbsolutePath, Filename);
+        llvm::sys::path::native(AbsolutePath, NativeFilePath);
+      } else {
+        llvm::sys::path::native(Filename, NativeFilePath);
+      }
+      llvm::sys::path::remove_dots(NativeFilePath, /*remove_dot_dot=*/true);
+      IndexByFile[NativeFilePath].push_back(I);
+      MatchTrie.insert(NativeFilePath);
+    }
+    return true;
+  }
+
+  void materialize(uint32_t I, std::vector<CompileCommand> &Commands) const {
+    const CommandRecord &Record = Records[I];
+    std::vector<std::string> CommandLine;
+    CommandLine.reserve(Record.NumArgs);
+    for (uint32_t A = 0; A != Record.NumArgs; ++A)
+      CommandLine.emplace_back(Strings[Args[Record.ArgStart + A]]);
+    Commands.emplace_back(Strings[Record.Directory], Strings[Record.Filename],
+                          std::move(CommandLine), Strings[Record.Output]);
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer> Buffer;
+  std::vector<StringRef> Strings;
+  std::vector<CommandRecord> Records;
+  std::vector<uint32_t> Args;
+  llvm::StringMap<std::vector<uint32_t>> IndexByFile;
+  FileMatchTrie MatchTrie;
+};
+
+constexpr char BinaryCompilationDatabase::Magic[4];
+
+/// Serialize \p Database into the sidecar format above. Production is
+/// best-effort: the sidecar is written to a temporary file and renamed into
+/// place, and any failure simply leaves the next run parsing the JSON again.
+void writeBinarySidecar(StringRef CachePath,
+                        const CompilationDatabase &Database,
+                        const llvm::sys::fs::file_status &JSONStatus) {
+  std::vector<CompileCommand> Commands = Database.getAllCompileCommands();
+
+  // Deduplicate strings; the table references storage owned by Commands.
+  llvm::StringMap<uint32_t> StringIndex;
+  std::vector<StringRef> StringTable;
+  auto InternString = [&](StringRef S) {
+    auto R = StringIndex.try_emplace(S, StringTable.size());
+    if (R.second)
+      StringTable.push_back(R.first->first());
+    return R.first->second;
+  };
+
+  SmallVector<char, 4096> RecordData;
+  llvm::raw_svector_ostream RecordOS(RecordData);
+  llvm::support::endian::Writer RecordWriter(RecordOS, llvm::support::little);
+  for (const CompileCommand &Command : Commands) {
+    RecordWriter.write<uint32_t>(InternString(Command.Directory));
+    RecordWriter.write<uint32_t>(InternString(Command.Filename));
+    RecordWriter.write<uint32_t>(InternString(Command.Output));
+    RecordWriter.write<uint32_t>(Command.CommandLine.size());
+    for (const std::string &Arg : Command.CommandLine)
+      RecordWriter.write<uint32_t>(InternString(Arg));
+  }
+
+  SmallString<128> TempPath;
+  int TempFD;
+  if (llvm::sys::fs::createUniqueFile(CachePath + ".tmp%%%%%%", TempFD,
+                                      TempPath))
+    return;
+  {
+    llvm::raw_fd_ostream OS(TempFD, /*shouldClose=*/true);
+    llvm::support::endian::Writer Writer(OS, llvm::support::little);
+    OS.write(BinaryCompilationDatabase::Magic, 4);
+    Writer.write<uint32_t>(BinaryCompilationDatabase::FormatVersion);
+    Writer.write<uint64_t>(JSONStatus.getSize());
+    Writer.write<uint64_t>(
+        llvm::sys::toTimeT(JSONStatus.getLastModificationTime()));
+    Writer.write<uint32_t>(Commands.size());
+    Writer.write<uint32_t>(StringTable.size());
+    Writer.write<uint64_t>(BinaryCompilationDatabase::HeaderSize +
+                           RecordData.size());
+    OS.write(RecordData.data(), RecordData.size());
+    for (StringRef S : StringTable)
+      Writer.write<uint32_t>(S.size());
+    for (StringRef S : StringTable)
+      OS.write(S.data(), S.size());
+    if (OS.has_error()) {
+      OS.clear_error();
+      llvm::sys::fs::remove(TempPath);
+      return;
+    }
+  }
+  if (llvm::sys::fs::rename(TempPath, CachePath))
+    llvm::sys::fs::remove(TempPath);
+}
+
 // This plugin locates a nearby compile_command.json file, and also infers
 // compile commands for files not present in the database.
 class JSONCompilationDatabasePlugin : public CompilationDatabasePlugin {
@@ -163,8 +431,27 @@ class JSONCompilationDatabasePlugin : public CompilationDatabasePlugin {
   loadFromDirectory(StringRef Directory, std::string &ErrorMessage) override {
     SmallString<1024> JSONDatabasePath(Directory);
     llvm::sys::path::append(JSONDatabasePath, "compile_commands.json");
-    auto Base = JSONCompilationDatabase::loadFromFile(
-        JSONDatabasePath, ErrorMessage, JSONCommandLineSyntax::AutoDetect);
+    SmallString<1024> CachePath(JSONDatabasePath);
+    CachePath += ".cache";
+
+    // Prefer the memory-mapped binary sidecar when it matches the current
+    // JSON; fall back to the JSON otherwise. Writing (and refreshing) the
+    // sidecar is opt-in: tools that merely read a database should not leave
+    // files behind in the user's build directory.
+    bool CacheEnabled =
+        llvm::sys::Process::GetEnv("CLANG_COMPILE_COMMANDS_CACHE").has_value();
+    std::unique_ptr<CompilationDatabase> Base;
+    llvm::sys::fs::file_status JSONStatus;
+    bool HaveJSONStatus = !llvm::sys::fs::status(JSONDatabasePath, JSONStatus);
+    if (HaveJSONStatus)
+      Base = BinaryCompilationDatabase::loadIfValid(CachePath, JSONStatus);
+    if (!Base) {
+      auto JSON = JSONCompilationDatabase::loadFromFile(
+          JSONDatabasePath, ErrorMessage, JSONCommandLineSyntax::AutoDetect);
+      if (JSON && HaveJSONStatus && CacheEnabled)
+        writeBinarySidecar(CachePath, *JSON, JSONStatus);
+      Base = std::move(JSON);
+    }
     return Base ? inferTargetAndDriverMode(
                       inferMissingCompileCommands(expandResponseFiles(
                           std::move(Base), llvm::vfs::getRealFileSystem())))
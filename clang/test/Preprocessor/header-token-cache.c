@@ -0,0 +1,83 @@
+// Tests for the -fcache-header-tokens token-stream cache. The cached output
+// must be byte-identical to a plain re-lex, macro redefinitions must
+// invalidate cached streams, the bail-outs (directives, builtin macros,
+// nested includes) must keep per-inclusion state correct, and file-change
+// callbacks must fire on the replay path exactly as on the lexed path.
+
+// RUN: rm -rf %t
+// RUN: split-file %s %t
+
+// Cache hit: the second inclusion replays the recorded stream and must
+// produce the same expansion as the first.
+// RUN: %clang_cc1 -E -fcache-header-tokens %t/hit.c \
+// RUN:   | FileCheck %t/hit.c
+// The cached output must match the uncached output token for token.
+// RUN: %clang_cc1 -E %t/hit.c | FileCheck %t/hit.c
+
+// Macro-dependency invalidation: redefining a macro the stream depends on
+// must drop the cached stream; the second inclusion sees the new definition.
+// RUN: %clang_cc1 -E -fcache-header-tokens %t/invalidate.c \
+// RUN:   | FileCheck %t/invalidate.c
+
+// Bail-out on builtin macros: __COUNTER__ must keep advancing across
+// inclusions, so the stream must never be recorded.
+// RUN: %clang_cc1 -E -fcache-header-tokens %t/builtin.c \
+// RUN:   | FileCheck %t/builtin.c
+
+// Bail-out on directives and nested includes: the outer header contains an
+// #include directive, so it may not be cached; the nested header's cached
+// stream must still be invalidated by the redefinition between inclusions.
+// RUN: %clang_cc1 -E -fcache-header-tokens %t/nested.c \
+// RUN:   | FileCheck %t/nested.c
+
+// Callback consistency: -H reports every inclusion through the FileChanged
+// callback, so the replayed second inclusion must be listed too.
+// RUN: %clang_cc1 -Eonly -H -fcache-header-tokens %t/hit.c 2>&1 \
+// RUN:   | FileCheck %t/callbacks.txt
+
+//--- hit.c
+#define VALUE 1
+#include "value.h"
+#include "value.h"
+// CHECK: int a = 1;
+// CHECK: int a = 1;
+
+//--- invalidate.c
+#define VALUE 1
+#include "value.h"
+#undef VALUE
+#define VALUE 2
+#include "value.h"
+// CHECK: int a = 1;
+// CHECK: int a = 2;
+
+//--- builtin.c
+#include "counter.h"
+#include "counter.h"
+// CHECK: int c = 0;
+// CHECK: int c = 1;
+
+//--- nested.c
+#define VALUE 1
+#include "outer.h"
+#undef VALUE
+#define VALUE 2
+#include "outer.h"
+// CHECK: int a = 1;
+// CHECK: int a = 2;
+
+//--- value.h
+int a = VALUE;
+
+//--- counter.h
+int c = __COUNTER__;
+
+//--- outer.h
+#include "inner.h"
+
+//--- inner.h
+int a = VALUE;
+
+//--- callbacks.txt
+CHECK: value.h
+CHECK: value.h
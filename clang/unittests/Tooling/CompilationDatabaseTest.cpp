@@ -13,11 +13,14 @@
 #include "clang/Tooling/FileMatchTrie.h"
 #include "clang/Tooling/JSONCompilationDatabase.h"
 #include "clang/Tooling/Tooling.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/raw_ostream.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include <algorithm>
+#include <cstdlib>
 
 namespace clang {
 namespace tooling {
@@ -226,6 +229,112 @@ TEST(JSONCompilationDatabase, ArgumentsPreferredOverCommand) {
    EXPECT_EQ(Arguments, FoundCommand.CommandLine[0]) << ErrorMessage;
 }
 
+// Exercises the opt-in binary sidecar (compile_commands.json.cache) through
+// loadFromDirectory, which is the only way it is produced and consumed.
+class JSONCompilationDatabaseCacheTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("ccdb-cache-test", Dir));
+    JSONPath = Dir;
+    llvm::sys::path::append(JSONPath, "compile_commands.json");
+    CachePath = JSONPath;
+    CachePath += ".cache";
+    std::string JSON = ("[{\"directory\":\"" + Dir + "\","
+                        "\"command\":\"clang++ -DA=1 a.cc\","
+                        "\"file\":\"a.cc\"},"
+                        "{\"directory\":\"" + Dir + "\","
+                        "\"command\":\"clang++ -DB=2 b.cc\","
+                        "\"file\":\"b.cc\"}]")
+                           .str();
+    std::error_code EC;
+    llvm::raw_fd_ostream OS(JSONPath, EC);
+    ASSERT_FALSE(EC);
+    OS << JSON;
+  }
+
+  void TearDown() override {
+    setCacheEnabled(false);
+    llvm::sys::fs::remove(CachePath);
+    llvm::sys::fs::remove(JSONPath);
+    llvm::sys::fs::remove(Dir);
+  }
+
+  static void setCacheEnabled(bool Enabled) {
+#ifdef _WIN32
+    _putenv_s("CLANG_COMPILE_COMMANDS_CACHE", Enabled ? "1" : "");
+#else
+    if (Enabled)
+      setenv("CLANG_COMPILE_COMMANDS_CACHE", "1", 1);
+    else
+      unsetenv("CLANG_COMPILE_COMMANDS_CACHE");
+#endif
+  }
+
+  // Loads the database and returns the -D flag of each command, sorted, so
+  // cache hits and JSON fallbacks can be compared for identical content.
+  std::vector<std::string> loadFlags() {
+    std::string Error;
+    auto DB = CompilationDatabase::loadFromDirectory(Dir, Error);
+    EXPECT_TRUE(DB) << Error;
+    if (!DB)
+      return {};
+    std::vector<std::string> Flags;
+    for (const CompileCommand &Command : DB->getAllCompileCommands())
+      for (const std::string &Arg : Command.CommandLine)
+        if (StringRef(Arg).starts_with("-D"))
+          Flags.push_back(Arg);
+    std::sort(Flags.begin(), Flags.end());
+    return Flags;
+  }
+
+  SmallString<128> Dir;
+  SmallString<128> JSONPath;
+  SmallString<128> CachePath;
+};
+
+TEST_F(JSONCompilationDatabaseCacheTest, NotWrittenByDefault) {
+  EXPECT_THAT(loadFlags(), ElementsAre("-DA=1", "-DB=2"));
+  EXPECT_FALSE(llvm::sys::fs::exists(CachePath));
+}
+
+TEST_F(JSONCompilationDatabaseCacheTest, RoundTrip) {
+  setCacheEnabled(true);
+  // First load parses the JSON and produces the sidecar.
+  EXPECT_THAT(loadFlags(), ElementsAre("-DA=1", "-DB=2"));
+  ASSERT_TRUE(llvm::sys::fs::exists(CachePath));
+  // Second load is served from the sidecar and must be indistinguishable.
+  EXPECT_THAT(loadFlags(), ElementsAre("-DA=1", "-DB=2"));
+}
+
+TEST_F(JSONCompilationDatabaseCacheTest, CorruptCacheFallsBackToJSON) {
+  setCacheEnabled(true);
+  EXPECT_THAT(loadFlags(), ElementsAre("-DA=1", "-DB=2"));
+  ASSERT_TRUE(llvm::sys::fs::exists(CachePath));
+
+  // Overwrite the command count (header offset 24) with a value far larger
+  // than the record region could hold; the loader must reject the sidecar
+  // without a huge allocation and fall back to the JSON.
+  {
+    std::error_code EC;
+    llvm::raw_fd_ostream OS(CachePath, EC, llvm::sys::fs::CD_OpenExisting,
+                            llvm::sys::fs::FA_Write, llvm::sys::fs::OF_None);
+    ASSERT_FALSE(EC);
+    OS.seek(24);
+    char Huge[4] = {'\xff', '\xff', '\xff', '\xff'};
+    OS.write(Huge, 4);
+  }
+  EXPECT_THAT(loadFlags(), ElementsAre("-DA=1", "-DB=2"));
+
+  // A sidecar truncated below the header size must be ignored too.
+  {
+    std::error_code EC;
+    llvm::raw_fd_ostream OS(CachePath, EC);
+    ASSERT_FALSE(EC);
+    OS << "CCDB";
+  }
+  EXPECT_THAT(loadFlags(), ElementsAre("-DA=1", "-DB=2"));
+}
+
 struct FakeComparator : public PathComparator {
   ~FakeComparator() override {}
   bool equivalent(StringRef FileA, StringRef FileB) const override {
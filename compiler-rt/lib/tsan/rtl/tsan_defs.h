@@ -30,6 +30,9 @@
 #  define __MM_MALLOC_H
 #  include <emmintrin.h>
 #  include <smmintrin.h>
+#  if defined(__AVX2__)
+#    include <immintrin.h>
+#  endif
 #  define VECTOR_ALIGNED ALIGNED(16)
 typedef __m128i m128;
 #else
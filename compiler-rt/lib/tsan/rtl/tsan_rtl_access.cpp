@@ -719,6 +719,34 @@ void MemoryAccessRangeT(ThreadState* thr, uptr pc, uptr addr, uptr size) {
   }
   // Handle middle part, if any.
   Shadow cur(fast_state, 0, kShadowCell, typ);
+#if TSAN_VECTORIZE && defined(__AVX2__)
+  // Fast path for long ranges: check two shadow cells per iteration.
+  // The common case for buffer-heavy programs is that the thread re-accesses
+  // memory it already owns, so every cell contains the same access and the
+  // per-cell path would do nothing but confirm that. The 256-bit comparison
+  // repeats the exact-match logic of ContainsSameAccess; range accesses
+  // always pass kAccessNoRodata and check Shadow::kRodata up front, so no
+  // rodata handling is needed here. If either cell fails the cheap check,
+  // fall back to the full per-cell processing for the pair.
+  const __m256i access_wide = _mm256_set1_epi32(static_cast<u32>(cur.raw()));
+  const __m256i read_mask_wide =
+      _mm256_set1_epi32(static_cast<u32>(Shadow::kRodata));
+  for (; size >= 2 * kShadowCell;
+       size -= 2 * kShadowCell, shadow_mem += 2 * kShadowCnt) {
+    __m256i shadow_wide =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shadow_mem));
+    if (typ & kAccessRead)
+      shadow_wide = _mm256_or_si256(shadow_wide, read_mask_wide);
+    const __m256i same = _mm256_cmpeq_epi32(shadow_wide, access_wide);
+    const u32 mask = _mm256_movemask_epi8(same);
+    if (LIKELY((mask & 0x0000ffff) && (mask & 0xffff0000)))
+      continue;
+    if (UNLIKELY(MemoryAccessRangeOne(thr, shadow_mem, cur, typ)))
+      return;
+    if (UNLIKELY(MemoryAccessRangeOne(thr, shadow_mem + kShadowCnt, cur, typ)))
+      return;
+  }
+#endif
   for (; size >= kShadowCell; size -= kShadowCell, shadow_mem += kShadowCnt) {
     if (UNLIKELY(MemoryAccessRangeOne(thr, shadow_mem, cur, typ)))
       return;
@@ -14,6 +14,10 @@
 #include <__utility/move.h>
 #include <cstddef>
 
+#ifndef _LIBCPP_HAS_NO_THREADS
+#  include <__thread/thread.h>
+#endif
+
 #if !defined(_LIBCPP_HAS_NO_PRAGMA_SYSTEM_HEADER)
 #  pragma GCC system_header
 #endif
@@ -23,19 +27,56 @@ _LIBCPP_PUSH_MACROS
 
 #if !defined(_LIBCPP_HAS_NO_INCOMPLETE_PSTL) && _LIBCPP_STD_VER >= 17
 
-// This backend implementation is for testing purposes only and not meant for production use. This will be replaced
-// by a proper implementation once the PSTL implementation is somewhat stable.
+// This backend distributes __parallel_for over std::thread workers via depth-limited binary splitting; the
+// remaining operations still run serially and will be replaced by proper implementations once the PSTL
+// implementation is somewhat stable.
 
 _LIBCPP_BEGIN_NAMESPACE_STD
 
 namespace __par_backend {
 inline namespace __thread_cpu_backend {
 
+#  ifndef _LIBCPP_HAS_NO_THREADS
+
+// Minimum number of elements a task should process: below this, the cost of
+// spawning and joining a thread outweighs the work being distributed.
+inline constexpr ptrdiff_t __thread_backend_grain_size = 2048;
+
+template <class _RandomAccessIterator, class _Fp>
+_LIBCPP_HIDE_FROM_ABI void __parallel_for_binary_split(
+    _RandomAccessIterator __first, _RandomAccessIterator __last, _Fp& __f, int __depth) {
+  auto __size = __last - __first;
+  if (__depth <= 0 || __size < 2 * __thread_backend_grain_size) {
+    __f(__first, __last);
+    return;
+  }
+  _RandomAccessIterator __mid = __first + __size / 2;
+  // If the user functor throws, it either escapes a worker thread or leaves
+  // this frame while __worker is joinable; both call std::terminate, which is
+  // what the parallel algorithms require for uncaught exceptions.
+  std::thread __worker([&] { std::__par_backend::__parallel_for_binary_split(__first, __mid, __f, __depth - 1); });
+  std::__par_backend::__parallel_for_binary_split(__mid, __last, __f, __depth - 1);
+  __worker.join();
+}
+
+template <class _RandomAccessIterator, class _Fp>
+_LIBCPP_HIDE_FROM_ABI void __parallel_for(_RandomAccessIterator __first, _RandomAccessIterator __last, _Fp __f) {
+  unsigned __hardware_threads = thread::hardware_concurrency();
+  int __depth = 0;
+  for (unsigned __chunks = 1; __chunks < __hardware_threads; __chunks *= 2)
+    ++__depth;
+  std::__par_backend::__parallel_for_binary_split(__first, __last, __f, __depth);
+}
+
+#  else // _LIBCPP_HAS_NO_THREADS
+
 template <class _RandomAccessIterator, class _Fp>
 _LIBCPP_HIDE_FROM_ABI void __parallel_for(_RandomAccessIterator __first, _RandomAccessIterator __last, _Fp __f) {
   __f(__first, __last);
 }
 
+#  endif // _LIBCPP_HAS_NO_THREADS
+
 template <class _Index, class _UnaryOp, class _Tp, class _BinaryOp, class _Reduce>
 _LIBCPP_HIDE_FROM_ABI _Tp
 __parallel_transform_reduce(_Index __first, _Index __last, _UnaryOp, _Tp __init, _BinaryOp, _Reduce __reduce) {
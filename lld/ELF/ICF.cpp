@@ -527,6 +527,8 @@ template <class ELFT> void ICF<ELFT>::run() {
   // Split groups by comparing relocations until convergence is obtained.
   do {
     repeat = false;
+    llvm::TimeTraceScope timeScope("ICF round",
+                                   [&] { return std::to_string(cnt); });
     forEachClass([&](size_t begin, size_t end) {
       segregate(begin, end, eqClassBase, false);
     });
@@ -1058,10 +1058,21 @@ void ObjFile<ELFT>::initializeSymbols(const object::ELFFile<ELFT> &obj) {
     symbols = std::make_unique<Symbol *[]>(numSymbols);
   }
 
-  // Some entries have been filled by LazyObjFile.
+  // Some entries have been filled by LazyObjFile. Present the remaining
+  // globals to the symbol table in one batch so that it can hash all names
+  // before probing its map.
+  SmallVector<StringRef, 0> names;
+  SmallVector<uint32_t, 0> indices;
+  names.reserve(eSyms.size() - firstGlobal);
   for (size_t i = firstGlobal, end = eSyms.size(); i != end; ++i)
-    if (!symbols[i])
-      symbols[i] = symtab.insert(CHECK(eSyms[i].getName(stringTable), this));
+    if (!symbols[i]) {
+      names.push_back(CHECK(eSyms[i].getName(stringTable), this));
+      indices.push_back(i);
+    }
+  SmallVector<Symbol *, 0> syms(names.size());
+  symtab.insertBatch(names, syms);
+  for (size_t i = 0, e = indices.size(); i != e; ++i)
+    symbols[indices[i]] = syms[i];
 
   // Perform symbol resolution on non-local symbols.
   SmallVector<unsigned, 32> undefineds;
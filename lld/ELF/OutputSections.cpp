@@ -444,7 +444,11 @@ static void writeInt(uint8_t *buf, uint64_t data, uint64_t size) {
 
 template <class ELFT>
 void OutputSection::writeTo(uint8_t *buf, parallel::TaskGroup &tg) {
-  llvm::TimeTraceScope timeScope("Write sections", name);
+  // Record the section size in the event detail so that time-trace output of
+  // two links can be diffed for per-section throughput, not just duration.
+  llvm::TimeTraceScope timeScope("Write sections", [&] {
+    return (Twine(name) + " (" + Twine(size) + " bytes)").str();
+  });
   if (type == SHT_NOBITS)
     return;
 
@@ -1550,18 +1550,26 @@ template <class ELFT> void elf::scanRelocations() {
   // for parallelism.
   bool serial = !config->zCombreloc || config->emachine == EM_MIPS ||
                 config->emachine == EM_PPC64;
+  // Sharding within a file keeps the load balanced even when a few large
+  // files (e.g. LTO outputs) contribute most of the sections.
+  constexpr size_t shardSize = 256;
   parallel::TaskGroup tg;
   for (ELFFileBase *f : ctx.objectFiles) {
-    auto fn = [f]() {
-      RelocationScanner scanner;
-      for (InputSectionBase *s : f->getSections()) {
-        if (s && s->kind() == SectionBase::Regular && s->isLive() &&
-            (s->flags & SHF_ALLOC) &&
-            !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
-          scanner.template scanSection<ELFT>(*s);
-      }
-    };
-    tg.spawn(fn, serial);
+    ArrayRef<InputSectionBase *> sections = f->getSections();
+    for (size_t begin = 0, end = sections.size(); begin < end;
+         begin += shardSize) {
+      auto fn = [=]() {
+        RelocationScanner scanner;
+        for (InputSectionBase *s :
+             sections.slice(begin, std::min(shardSize, end - begin))) {
+          if (s && s->kind() == SectionBase::Regular && s->isLive() &&
+              (s->flags & SHF_ALLOC) &&
+              !(s->type == SHT_ARM_EXIDX && config->emachine == EM_ARM))
+            scanner.template scanSection<ELFT>(*s);
+        }
+      };
+      tg.spawn(fn, serial);
+    }
   }
 
   tg.spawn([] {
@@ -20,8 +20,10 @@
 #include "lld/Common/ErrorHandler.h"
 #include "lld/Common/Memory.h"
 #include "lld/Common/Strings.h"
+#include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/Demangle/Demangle.h"
+#include "llvm/Support/Compiler.h"
 
 using namespace llvm;
 using namespace llvm::object;
@@ -75,7 +77,12 @@ Symbol *SymbolTable::insert(StringRef name) {
   if (pos != StringRef::npos && pos + 1 < name.size() && name[pos + 1] == '@')
     stem = name.take_front(pos);
 
-  auto p = symMap.insert({CachedHashStringRef(stem), (int)symVector.size()});
+  return insert(name, CachedHashStringRef(stem), pos != StringRef::npos);
+}
+
+Symbol *SymbolTable::insert(StringRef name, CachedHashStringRef stem,
+                            bool hasVersionSuffix) {
+  auto p = symMap.insert({stem, (int)symVector.size()});
   if (!p.second) {
     Symbol *sym = symVector[p.first->second];
     if (stem.size() != name.size()) {
@@ -94,11 +101,39 @@ Symbol *SymbolTable::insert(StringRef name) {
   sym->partition = 1;
   sym->verdefIndex = -1;
   sym->versionId = VER_NDX_GLOBAL;
-  if (pos != StringRef::npos)
+  if (hasVersionSuffix)
     sym->hasVersionSuffix = true;
   return sym;
 }
 
+// Batched variant of insert() for callers that know all global symbol names
+// of an input file up front. Hashing every name in a first pass breaks the
+// dependency between computing a name's hash and probing the map with it: the
+// hash loop streams over the string table (prefetching the next names' bytes)
+// and the probe loop then runs with all hashes already materialized in a
+// flat array.
+void SymbolTable::insertBatch(ArrayRef<StringRef> names,
+                              MutableArrayRef<Symbol *> syms) {
+  assert(names.size() == syms.size());
+  SmallVector<CachedHashStringRef, 0> stems;
+  stems.reserve(names.size());
+  BitVector hasVersionSuffix(names.size());
+  for (size_t i = 0, e = names.size(); i != e; ++i) {
+    if (i + 8 < e)
+      LLVM_PREFETCH(names[i + 8].data(), 0, 3);
+    StringRef name = names[i];
+    StringRef stem = name;
+    size_t pos = name.find('@');
+    if (pos != StringRef::npos && pos + 1 < name.size() && name[pos + 1] == '@')
+      stem = name.take_front(pos);
+    stems.push_back(CachedHashStringRef(stem));
+    if (pos != StringRef::npos)
+      hasVersionSuffix.set(i);
+  }
+  for (size_t i = 0, e = names.size(); i != e; ++i)
+    syms[i] = insert(names[i], stems[i], hasVersionSuffix[i]);
+}
+
 // This variant of addSymbol is used by BinaryFile::parse to check duplicate
 // symbol errors.
 Symbol *SymbolTable::addAndCheckDuplicate(const Defined &newSym) {
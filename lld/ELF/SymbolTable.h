@@ -44,6 +44,11 @@ public:
 
   Symbol *insert(StringRef name);
 
+  // Resolve all of names at once, filling the parallel syms array. Hashes all
+  // names before probing the map, which is faster than repeated insert()
+  // calls when an object file presents its global symbols in bulk.
+  void insertBatch(ArrayRef<StringRef> names, MutableArrayRef<Symbol *> syms);
+
   template <typename T> Symbol *addSymbol(const T &newSym) {
     Symbol *sym = insert(newSym.getName());
     sym->resolve(newSym);
@@ -78,6 +83,9 @@ public:
   llvm::StringMap<bool> inCMSEOutImpLib;
 
 private:
+  Symbol *insert(StringRef name, llvm::CachedHashStringRef stem,
+                 bool hasVersionSuffix);
+
   SmallVector<Symbol *, 0> findByVersion(SymbolVersion ver);
   SmallVector<Symbol *, 0> findAllByVersion(SymbolVersion ver,
                                             bool includeNonDefault);
@@ -3302,10 +3302,11 @@ void MergeNoTailSection::finalizeContents() {
     }
   });
 
-  // Compute an in-section offset for each shard.
+  // Finalize the shards (independent of each other), then compute an
+  // in-section offset for each one.
+  parallelFor(0, numShards, [&](size_t i) { shards[i].finalizeInOrder(); });
   size_t off = 0;
   for (size_t i = 0; i < numShards; ++i) {
-    shards[i].finalizeInOrder();
     if (shards[i].getSize() > 0)
       off = alignToPowerOf2(off, addralign);
     shardOffsets[i] = off;
@@ -978,8 +978,10 @@ private:
   // Section size
   size_t size;
 
-  // String table contents
-  constexpr static size_t numShards = 32;
+  // String table contents. The shard count bounds both the deduplication
+  // concurrency and the size of each shard's hash map, so keep it well above
+  // the core counts we expect to run on.
+  constexpr static size_t numShards = 256;
   SmallVector<llvm::StringTableBuilder, 0> shards;
   size_t shardOffsets[numShards];
 };
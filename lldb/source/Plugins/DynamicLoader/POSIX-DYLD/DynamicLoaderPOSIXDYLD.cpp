@@ -10,6 +10,7 @@
 #include "DynamicLoaderPOSIXDYLD.h"
 
 #include "lldb/Breakpoint/BreakpointLocation.h"
+#include "lldb/Core/Debugger.h"
 #include "lldb/Core/Module.h"
 #include "lldb/Core/ModuleSpec.h"
 #include "lldb/Core/PluginManager.h"
@@ -24,9 +25,11 @@
 #include "lldb/Utility/LLDBLog.h"
 #include "lldb/Utility/Log.h"
 #include "lldb/Utility/ProcessInfo.h"
+#include "llvm/Support/ThreadPool.h"
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 using namespace lldb;
 using namespace lldb_private;
@@ -201,12 +204,18 @@ void DynamicLoaderPOSIXDYLD::UpdateLoadedSections(ModuleSP module,
                                                   addr_t link_map_addr,
                                                   addr_t base_addr,
                                                   bool base_addr_is_offset) {
-  m_loaded_modules[module] = link_map_addr;
+  {
+    std::lock_guard<std::mutex> guard(m_loaded_modules_mutex);
+    m_loaded_modules[module] = link_map_addr;
+  }
   UpdateLoadedSectionsCommon(module, base_addr, base_addr_is_offset);
 }
 
 void DynamicLoaderPOSIXDYLD::UnloadSections(const ModuleSP module) {
-  m_loaded_modules.erase(module);
+  {
+    std::lock_guard<std::mutex> guard(m_loaded_modules_mutex);
+    m_loaded_modules.erase(module);
+  }
 
   UnloadSectionsCommon(module);
 }
@@ -644,19 +653,34 @@ void DynamicLoaderPOSIXDYLD::LoadAllCurrentModules() {
   m_process->PrefetchModuleSpecs(
       module_names, m_process->GetTarget().GetArchitecture().GetTriple());
 
-  for (I = m_rendezvous.begin(), E = m_rendezvous.end(); I != E; ++I) {
-    ModuleSP module_sp =
-        LoadModuleAtAddress(I->file_spec, I->link_addr, I->base_addr, true);
-    if (module_sp.get()) {
+  // Loading a module reads its object file and (with symbol preloading
+  // enabled) parses its symbol table, which dominates attach time when a
+  // process maps many shared libraries. The target is prepared for modules
+  // being created concurrently, so load each rendezvous entry on the shared
+  // thread pool and keep the resulting module list in rendezvous order.
+  std::vector<DYLDRendezvous::SOEntry> entries(m_rendezvous.begin(),
+                                               m_rendezvous.end());
+  std::vector<ModuleSP> modules(entries.size());
+  llvm::ThreadPoolTaskGroup task_group(Debugger::GetThreadPool());
+  for (size_t idx = 0; idx < entries.size(); ++idx)
+    task_group.async([this, &entries, &modules, idx] {
+      modules[idx] = LoadModuleAtAddress(entries[idx].file_spec,
+                                         entries[idx].link_addr,
+                                         entries[idx].base_addr, true);
+    });
+  task_group.wait();
+
+  for (size_t idx = 0; idx < entries.size(); ++idx) {
+    if (modules[idx]) {
       LLDB_LOG(log, "LoadAllCurrentModules loading module: {0}",
-               I->file_spec.GetFilename());
-      module_list.Append(module_sp);
+               entries[idx].file_spec.GetFilename());
+      module_list.Append(modules[idx]);
     } else {
-      Log *log = GetLog(LLDBLog::DynamicLoader);
       LLDB_LOGF(
           log,
           "DynamicLoaderPOSIXDYLD::%s failed loading module %s at 0x%" PRIx64,
-          __FUNCTION__, I->file_spec.GetPath().c_str(), I->base_addr);
+          __FUNCTION__, entries[idx].file_spec.GetPath().c_str(),
+          entries[idx].base_addr);
     }
   }
 
@@ -727,11 +751,14 @@ lldb::addr_t
 DynamicLoaderPOSIXDYLD::GetThreadLocalData(const lldb::ModuleSP module_sp,
                                            const lldb::ThreadSP thread,
                                            lldb::addr_t tls_file_addr) {
-  auto it = m_loaded_modules.find(module_sp);
-  if (it == m_loaded_modules.end())
-    return LLDB_INVALID_ADDRESS;
-
-  addr_t link_map = it->second;
+  addr_t link_map = LLDB_INVALID_ADDRESS;
+  {
+    std::lock_guard<std::mutex> guard(m_loaded_modules_mutex);
+    auto it = m_loaded_modules.find(module_sp);
+    if (it == m_loaded_modules.end())
+      return LLDB_INVALID_ADDRESS;
+    link_map = it->second;
+  }
   if (link_map == LLDB_INVALID_ADDRESS)
     return LLDB_INVALID_ADDRESS;
 
@@ -11,6 +11,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "DYLDRendezvous.h"
 #include "Plugins/Process/Utility/AuxVector.h"
@@ -91,6 +92,10 @@ protected:
   std::map<lldb::ModuleWP, lldb::addr_t, std::owner_less<lldb::ModuleWP>>
       m_loaded_modules;
 
+  /// Protects `m_loaded_modules`, which is updated concurrently when the
+  /// initial set of modules is loaded in parallel.
+  std::mutex m_loaded_modules_mutex;
+
   /// Returns true if the process is for a core file.
   bool IsCoreFile() const;
 
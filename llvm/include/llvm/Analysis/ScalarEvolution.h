@@ -79,6 +79,11 @@ class SCEV : public FoldingSetNode {
   /// ScalarEvolution's BumpPtrAllocator holds the data.
   FoldingSetNodeIDRef FastID;
 
+  /// Hash of FastID, computed once at construction. The folding set rehashes
+  /// every node whenever its bucket array grows; caching the hash makes that
+  /// O(nodes) instead of rehashing each node's ID words.
+  const unsigned FastIDHash;
+
   // The SCEV baseclass this node corresponds to
   const SCEVTypes SCEVType;
 
@@ -137,7 +142,8 @@ public:
 
   explicit SCEV(const FoldingSetNodeIDRef ID, SCEVTypes SCEVTy,
                 unsigned short ExpressionSize)
-      : FastID(ID), SCEVType(SCEVTy), ExpressionSize(ExpressionSize) {}
+      : FastID(ID), FastIDHash(ID.ComputeHash()), SCEVType(SCEVTy),
+        ExpressionSize(ExpressionSize) {}
   SCEV(const SCEV &) = delete;
   SCEV &operator=(const SCEV &) = delete;
 
@@ -193,7 +199,7 @@ template <> struct FoldingSetTrait<SCEV> : DefaultFoldingSetTrait<SCEV> {
   }
 
   static unsigned ComputeHash(const SCEV &X, FoldingSetNodeID &TempID) {
-    return X.FastID.ComputeHash();
+    return X.FastIDHash;
   }
 };
 
@@ -227,69 +227,74 @@ public:
   }
 
   Expected<uint32_t> ReadVBR(const unsigned NumBits) {
-    Expected<unsigned> MaybeRead = Read(NumBits);
-    if (!MaybeRead)
-      return MaybeRead;
-    uint32_t Piece = MaybeRead.get();
-
     assert(NumBits <= 32 && NumBits >= 1 && "Invalid NumBits value");
+    static const unsigned BitsInWord = sizeof(word_t) * 8;
+    static const unsigned ShiftMask = sizeof(word_t) > 4 ? 0x3f : 0x1f;
     const uint32_t MaskBitOrder = (NumBits - 1);
     const uint32_t Mask = 1UL << MaskBitOrder;
 
-    if ((Piece & Mask) == 0)
-      return Piece;
-
     uint32_t Result = 0;
     unsigned NextBit = 0;
     while (true) {
-      Result |= (Piece & (Mask - 1)) << NextBit;
+      uint32_t Piece;
+      // Batch decoding: pull chunks straight out of the buffered word while
+      // it holds enough bits, so a multi-chunk VBR pays for at most one
+      // refill check per word instead of one per chunk.
+      if (LLVM_LIKELY(BitsInCurWord >= NumBits)) {
+        Piece = CurWord & (~word_t(0) >> (BitsInWord - NumBits));
+        CurWord >>= (NumBits & ShiftMask);
+        BitsInCurWord -= NumBits;
+      } else {
+        Expected<word_t> MaybeRead = Read(NumBits);
+        if (!MaybeRead)
+          return MaybeRead.takeError();
+        Piece = MaybeRead.get();
+      }
 
       if ((Piece & Mask) == 0)
-        return Result;
+        return Result | (Piece << NextBit);
 
-      NextBit += NumBits-1;
+      Result |= (Piece & (Mask - 1)) << NextBit;
+      NextBit += NumBits - 1;
       if (NextBit >= 32)
         return createStringError(std::errc::illegal_byte_sequence,
                                  "Unterminated VBR");
-
-      MaybeRead = Read(NumBits);
-      if (!MaybeRead)
-        return MaybeRead;
-      Piece = MaybeRead.get();
     }
   }
 
   // Read a VBR that may have a value up to 64-bits in size. The chunk size of
   // the VBR must still be <= 32 bits though.
   Expected<uint64_t> ReadVBR64(const unsigned NumBits) {
-    Expected<uint64_t> MaybeRead = Read(NumBits);
-    if (!MaybeRead)
-      return MaybeRead;
-    uint32_t Piece = MaybeRead.get();
     assert(NumBits <= 32 && NumBits >= 1 && "Invalid NumBits value");
+    static const unsigned BitsInWord = sizeof(word_t) * 8;
+    static const unsigned ShiftMask = sizeof(word_t) > 4 ? 0x3f : 0x1f;
     const uint32_t MaskBitOrder = (NumBits - 1);
     const uint32_t Mask = 1UL << MaskBitOrder;
 
-    if ((Piece & Mask) == 0)
-      return uint64_t(Piece);
-
     uint64_t Result = 0;
     unsigned NextBit = 0;
     while (true) {
-      Result |= uint64_t(Piece & (Mask - 1)) << NextBit;
+      uint32_t Piece;
+      // Batch decoding: see ReadVBR above.
+      if (LLVM_LIKELY(BitsInCurWord >= NumBits)) {
+        Piece = CurWord & (~word_t(0) >> (BitsInWord - NumBits));
+        CurWord >>= (NumBits & ShiftMask);
+        BitsInCurWord -= NumBits;
+      } else {
+        Expected<word_t> MaybeRead = Read(NumBits);
+        if (!MaybeRead)
+          return MaybeRead.takeError();
+        Piece = MaybeRead.get();
+      }
 
       if ((Piece & Mask) == 0)
-        return Result;
+        return Result | (uint64_t(Piece) << NextBit);
 
-      NextBit += NumBits-1;
+      Result |= uint64_t(Piece & (Mask - 1)) << NextBit;
+      NextBit += NumBits - 1;
       if (NextBit >= 64)
         return createStringError(std::errc::illegal_byte_sequence,
                                  "Unterminated VBR");
-
-      MaybeRead = Read(NumBits);
-      if (!MaybeRead)
-        return MaybeRead;
-      Piece = MaybeRead.get();
     }
   }
 
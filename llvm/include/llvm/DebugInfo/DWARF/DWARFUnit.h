@@ -242,9 +242,21 @@ class DWARFUnit {
 
   /// Map from range's start address to end address and corresponding DIE.
   /// IntervalMap does not support range removal, as a result, we use the
-  /// std::map::upper_bound for address range lookup.
+  /// std::map::upper_bound for address range lookup. Only used while the
+  /// index is built; lookups are served from AddrDieRanges.
   std::map<uint64_t, std::pair<uint64_t, DWARFDie>> AddrDieMap;
 
+  struct AddrDieRange {
+    uint64_t LowPC;
+    uint64_t HighPC;
+    DWARFDie Die;
+  };
+
+  /// Flat, address-sorted copy of AddrDieMap. Built once per unit from the
+  /// map, which is then discarded; binary searching this vector is cheaper
+  /// per lookup than walking std::map nodes.
+  std::vector<AddrDieRange> AddrDieRanges;
+
   /// Map from the location (interpreted DW_AT_location) of a DW_TAG_variable,
   /// to the end address and the corresponding DIE.
   std::map<uint64_t, std::pair<uint64_t, DWARFDie>> VariableDieMap;
@@ -80,6 +80,21 @@ public:
                                      object::SectionedAddress ModuleOffset);
   Expected<DILineInfo> symbolizeCode(ArrayRef<uint8_t> BuildID,
                                      object::SectionedAddress ModuleOffset);
+
+  /// Batched variants of symbolizeCode. The module is resolved once and the
+  /// addresses are processed in ascending order, so consecutive lookups stay
+  /// within the same compile unit and reuse its DIE and line-table caches.
+  /// Results are returned in the order of \p ModuleOffsets.
+  Expected<std::vector<DILineInfo>>
+  symbolizeCode(const ObjectFile &Obj,
+                ArrayRef<object::SectionedAddress> ModuleOffsets);
+  Expected<std::vector<DILineInfo>>
+  symbolizeCode(const std::string &ModuleName,
+                ArrayRef<object::SectionedAddress> ModuleOffsets);
+  Expected<std::vector<DILineInfo>>
+  symbolizeCode(ArrayRef<uint8_t> BuildID,
+                ArrayRef<object::SectionedAddress> ModuleOffsets);
+
   Expected<DIInliningInfo>
   symbolizeInlinedCode(const ObjectFile &Obj,
                        object::SectionedAddress ModuleOffset);
@@ -136,6 +151,10 @@ private:
   symbolizeCodeCommon(const T &ModuleSpecifier,
                       object::SectionedAddress ModuleOffset);
   template <typename T>
+  Expected<std::vector<DILineInfo>>
+  symbolizeCodeBatchCommon(const T &ModuleSpecifier,
+                           ArrayRef<object::SectionedAddress> ModuleOffsets);
+  template <typename T>
   Expected<DIInliningInfo>
   symbolizeInlinedCodeCommon(const T &ModuleSpecifier,
                              object::SectionedAddress ModuleOffset);
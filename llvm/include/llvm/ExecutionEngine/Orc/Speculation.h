@@ -67,19 +67,31 @@ private:
   void registerSymbolsWithAddr(TargetFAddr ImplAddr,
                                SymbolNameSet likelySymbols) {
     std::lock_guard<std::mutex> Lockit(ConcurrentAccess);
-    GlobalSpecMap.insert({ImplAddr, std::move(likelySymbols)});
+    // Merge with any candidates already registered for this stub so that
+    // multiple prediction sources (the static IR heuristic, call patterns
+    // replayed from previous runs, ...) layer on top of each other instead
+    // of the first registration winning.
+    auto [It, Inserted] = GlobalSpecMap.try_emplace(ImplAddr);
+    if (Inserted)
+      It->getSecond() = std::move(likelySymbols);
+    else
+      for (auto &Sym : likelySymbols)
+        It->getSecond().insert(Sym);
   }
 
   void launchCompile(ExecutorAddr FAddr) {
     SymbolNameSet CandidateSet;
-    // Copy CandidateSet is necessary, to avoid unsynchronized access to
-    // the datastructure.
+    // Take ownership of the candidate set. A lazy call-through only funnels
+    // through the speculator on its first call, so the entry will not be
+    // needed again; consuming it avoids a copy and bounds the map's growth
+    // over long sessions.
     {
       std::lock_guard<std::mutex> Lockit(ConcurrentAccess);
       auto It = GlobalSpecMap.find(FAddr);
       if (It == GlobalSpecMap.end())
         return;
-      CandidateSet = It->getSecond();
+      CandidateSet = std::move(It->getSecond());
+      GlobalSpecMap.erase(It);
     }
 
     SymbolDependenceMap SpeculativeLookUpImpls;
@@ -135,6 +147,10 @@ public:
   // destination of __orc_speculate_for jump
   void speculateFor(TargetFAddr StubAddr) { launchCompile(StubAddr); }
 
+  // Register likely-to-be-called symbols for each target function. This is
+  // fed by IRSpeculationLayer's static heuristic, but clients may also call
+  // it directly with predictions from elsewhere (e.g. call sequences recorded
+  // in earlier runs); candidate sets registered for the same target merge.
   // FIXME : Register with Stub Address, after JITLink Fix.
   void registerSymbols(FunctionCandidatesMap Candidates, JITDylib *JD) {
     for (auto &SymPair : Candidates) {
@@ -23,6 +23,7 @@
 
 #if LLVM_ENABLE_THREADS
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <thread>
 #endif
@@ -121,6 +122,12 @@ private:
   bool Running = true;
   size_t Outstanding = 0;
   std::condition_variable OutstandingCV;
+  /// Threads that have finished their task and are waiting for more work.
+  /// Each entry in WorkQueue has a matching idle thread reserved for it, so
+  /// queued tasks can never be starved by a blocked worker.
+  size_t IdleThreads = 0;
+  std::deque<std::unique_ptr<Task>> WorkQueue;
+  std::condition_variable WorkAvailableCV;
 };
 
 #endif // LLVM_ENABLE_THREADS
@@ -149,6 +149,17 @@ public:
   /// especially in release mode.
   void setDiscardValueNames(bool Discard);
 
+  /// Opt-in mode that carves User allocations (instructions together with
+  /// their co-allocated use lists) made on the calling thread out of a
+  /// context-owned BumpPtrAllocator instead of the heap. Individual deletes
+  /// become cheap tombstones and the memory is reclaimed in bulk when the
+  /// context is destroyed, which trades peak memory for allocation throughput
+  /// and cache locality in long IR-churning pipelines such as LTO.
+  void setArenaAllocation(bool Enable);
+
+  /// Return true if arena allocation has ever been enabled on this context.
+  bool hasArenaAllocation() const;
+
   /// Whether there is a string map for uniquing debug info
   /// identifiers across the context.  Off by default.
   bool isODRUniquingDebugTypes() const;
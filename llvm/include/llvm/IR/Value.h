@@ -110,7 +110,11 @@ protected:
   ///
   /// Note, this should *NOT* be used directly by any class other than User.
   /// User uses this value to find the Use list.
-  enum : unsigned { NumUserOperandsBits = 27 };
+  ///
+  /// Reduced from 27 to make room for the HasArenaStorage bit below, so a
+  /// single User is now limited to 2^26-1 operands (the asserts in User
+  /// enforce this). No in-tree producer comes near either bound.
+  enum : unsigned { NumUserOperandsBits = 26 };
   unsigned NumUserOperands : NumUserOperandsBits;
 
   // Use the same type as the bitfield above so that MSVC will pack them.
@@ -119,6 +123,9 @@ protected:
   unsigned HasMetadata : 1; // Has metadata attached to this?
   unsigned HasHungOffUses : 1;
   unsigned HasDescriptor : 1;
+  // Storage (including co-allocated uses) lives in an LLVMContext-owned
+  // arena and must not be freed piecemeal. See LLVMContext::setArenaAllocation.
+  unsigned HasArenaStorage : 1;
 
 private:
   template <typename UseT> // UseT == 'Use' or 'const Use'
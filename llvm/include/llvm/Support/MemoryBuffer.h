@@ -82,6 +82,12 @@ public:
   /// function should not be called on a writable buffer.
   virtual void dontNeedIfMmap() {}
 
+  /// For MemoryBuffer_MMap, hint that the buffer will be accessed in the near
+  /// future so the kernel can start reading the backing pages ahead of the
+  /// first access. This calls madvise(MADV_WILLNEED) on file mappings on *NIX
+  /// systems and is a no-op elsewhere.
+  virtual void willNeedIfMmap() {}
+
   /// Open the specified file as a MemoryBuffer, returning a new MemoryBuffer
   /// if successful, otherwise returning null.
   ///
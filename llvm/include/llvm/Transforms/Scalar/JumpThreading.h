@@ -21,6 +21,7 @@
 #include "llvm/Analysis/BlockFrequencyInfo.h"
 #include "llvm/Analysis/BranchProbabilityInfo.h"
 #include "llvm/Analysis/DomTreeUpdater.h"
+#include "llvm/IR/PredIteratorCache.h"
 #include "llvm/IR/ValueHandle.h"
 #include <optional>
 #include <utility>
@@ -96,6 +97,13 @@ class JumpThreadingPass : public PassInfoMixin<JumpThreadingPass> {
   unsigned BBDupThreshold;
   unsigned DefaultBBDupThreshold;
 
+  /// Caches predecessor lists for the duration of one
+  /// computeValueKnownInPredecessors query. The query tree revisits the same
+  /// blocks repeatedly and the CFG cannot change while it runs, so this is
+  /// dropped (and its arena reused) at the start of each query rather than
+  /// tracking invalidation across the pass's CFG updates.
+  PredIteratorCache BlockPredsCache;
+
 public:
   JumpThreadingPass(int T = -1);
 
@@ -137,6 +145,7 @@ public:
                                   jumpthreading::ConstantPreference Preference,
                                   Instruction *CxtI = nullptr) {
     DenseSet<Value *> RecursionSet;
+    BlockPredsCache.clear();
     return computeValueKnownInPredecessorsImpl(V, BB, Result, Preference,
                                                RecursionSet, CxtI);
   }
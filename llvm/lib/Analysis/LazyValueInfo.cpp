@@ -170,8 +170,12 @@ namespace {
     /// Cached information per basic block.
     DenseMap<PoisoningVH<BasicBlock>, std::unique_ptr<BlockCacheEntry>>
         BlockCache;
-    /// Set of value handles used to erase values from the cache on deletion.
-    DenseSet<LVIValueHandle, DenseMapInfo<Value *>> ValueHandles;
+    /// Map of value handles to the blocks in which the value has cached
+    /// information. The handles erase values from the cache on deletion, and
+    /// the block sets limit that erasure to the blocks actually affected.
+    DenseMap<LVIValueHandle, SmallDenseSet<PoisoningVH<BasicBlock>, 4>,
+             DenseMapInfo<Value *>>
+        ValueHandles;
 
     const BlockCacheEntry *getBlockEntry(BasicBlock *BB) const {
       auto It = BlockCache.find_as(BB);
@@ -189,10 +193,11 @@ namespace {
       return It->second.get();
     }
 
-    void addValueHandle(Value *Val) {
+    void addValueHandle(Value *Val, BasicBlock *BB) {
       auto HandleIt = ValueHandles.find_as(Val);
       if (HandleIt == ValueHandles.end())
-        ValueHandles.insert({ Val, this });
+        HandleIt = ValueHandles.insert({ { Val, this }, {} }).first;
+      HandleIt->second.insert(BB);
     }
 
   public:
@@ -207,7 +212,7 @@ namespace {
       else
         Entry->LatticeElements.insert({ Val, Result });
 
-      addValueHandle(Val);
+      addValueHandle(Val, BB);
     }
 
     std::optional<ValueLatticeElement>
@@ -233,7 +238,7 @@ namespace {
       if (!Entry->NonNullPointers) {
         Entry->NonNullPointers = InitFn(BB);
         for (Value *V : *Entry->NonNullPointers)
-          addValueHandle(V);
+          addValueHandle(V, BB);
       }
 
       return Entry->NonNullPointers->count(V);
@@ -260,16 +265,23 @@ namespace {
 }
 
 void LazyValueInfoCache::eraseValue(Value *V) {
-  for (auto &Pair : BlockCache) {
-    Pair.second->LatticeElements.erase(V);
-    Pair.second->OverDefined.erase(V);
-    if (Pair.second->NonNullPointers)
-      Pair.second->NonNullPointers->erase(V);
+  auto HandleIt = ValueHandles.find_as(V);
+  if (HandleIt == ValueHandles.end())
+    return;
+
+  // Only the blocks recorded for this value can contain cached information
+  // about it. Blocks erased since the value was cached are simply skipped.
+  for (const PoisoningVH<BasicBlock> &BB : HandleIt->second) {
+    auto It = BlockCache.find(BB);
+    if (It == BlockCache.end())
+      continue;
+    It->second->LatticeElements.erase(V);
+    It->second->OverDefined.erase(V);
+    if (It->second->NonNullPointers)
+      It->second->NonNullPointers->erase(V);
   }
 
-  auto HandleIt = ValueHandles.find_as(V);
-  if (HandleIt != ValueHandles.end())
-    ValueHandles.erase(HandleIt);
+  ValueHandles.erase(HandleIt);
 }
 
 void LVIValueHandle::deleted() {
@@ -11,10 +11,12 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Analysis/TargetLibraryInfo.h"
+#include "llvm/ADT/StringMap.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/InitializePasses.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/TargetParser/Triple.h"
+#include <mutex>
 using namespace llvm;
 
 static cl::opt<TargetLibraryInfoImpl::VectorLibrary> ClVectorLibrary(
@@ -1265,12 +1267,30 @@ StringRef TargetLibraryInfoImpl::getVectorizedFunction(StringRef F,
   return StringRef();
 }
 
+/// A process-wide cache of baseline library info, keyed by target triple.
+/// Building TargetLibraryInfoImpl walks the whole libcall table and is pure in
+/// the triple, so every compilation in the process (including concurrent
+/// ThinLTO backend threads) can share one read-only instance per triple
+/// instead of rebuilding it for each module.
+static const TargetLibraryInfoImpl &getSharedBaselineImpl(const Triple &T) {
+  static std::mutex Lock;
+  static StringMap<std::unique_ptr<TargetLibraryInfoImpl>> Cache;
+  std::lock_guard<std::mutex> Guard(Lock);
+  std::unique_ptr<TargetLibraryInfoImpl> &Entry = Cache[T.str()];
+  if (!Entry)
+    Entry = std::make_unique<TargetLibraryInfoImpl>(T);
+  return *Entry;
+}
+
 TargetLibraryInfo TargetLibraryAnalysis::run(const Function &F,
                                              FunctionAnalysisManager &) {
-  if (!BaselineInfoImpl)
-    BaselineInfoImpl =
-        TargetLibraryInfoImpl(Triple(F.getParent()->getTargetTriple()));
-  return TargetLibraryInfo(*BaselineInfoImpl, &F);
+  // Analyses constructed with an explicit baseline (e.g. a frontend that
+  // customized the vector library) keep their private copy; the default
+  // triple-derived baseline comes from the shared cache.
+  if (BaselineInfoImpl)
+    return TargetLibraryInfo(*BaselineInfoImpl, &F);
+  return TargetLibraryInfo(
+      getSharedBaselineImpl(Triple(F.getParent()->getTargetTriple())), &F);
 }
 
 unsigned TargetLibraryInfoImpl::getWCharSize(const Module &M) const {
@@ -4875,7 +4875,11 @@ void llvm::WriteBitcodeToFile(const Module &M, raw_ostream &Out,
   if (TT.isOSDarwin() || TT.isOSBinFormatMachO())
     Buffer.insert(Buffer.begin(), BWH_HeaderSize, 0);
 
-  BitcodeWriter Writer(Buffer, dyn_cast<raw_fd_stream>(&Out));
+  // writeModuleHash hashes the module block out of the in-memory buffer, and
+  // an incremental flush truncates that buffer mid-block; keep the writer
+  // fully buffered whenever a hash was requested.
+  BitcodeWriter Writer(Buffer,
+                       GenerateHash ? nullptr : dyn_cast<raw_fd_stream>(&Out));
   Writer.writeModule(M, ShouldPreserveUseListOrder, Index, GenerateHash,
                      ModHash);
   Writer.writeSymtab();
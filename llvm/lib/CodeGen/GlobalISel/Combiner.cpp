@@ -51,6 +51,7 @@ namespace {
 class WorkListMaintainer : public GISelChangeObserver {
   using WorkListTy = GISelWorkList<512>;
   WorkListTy &WorkList;
+  MachineRegisterInfo &MRI;
   /// The instructions that have been created but we want to report once they
   /// have their operands. This is only maintained if debug output is requested.
 #ifndef NDEBUG
@@ -58,7 +59,8 @@ class WorkListMaintainer : public GISelChangeObserver {
 #endif
 
 public:
-  WorkListMaintainer(WorkListTy &WorkList) : WorkList(WorkList) {}
+  WorkListMaintainer(WorkListTy &WorkList, MachineRegisterInfo &MRI)
+      : WorkList(WorkList), MRI(MRI) {}
   virtual ~WorkListMaintainer() = default;
 
   void erasingInstr(MachineInstr &MI) override {
@@ -77,6 +79,13 @@ public:
   void changedInstr(MachineInstr &MI) override {
     LLVM_DEBUG(dbgs() << "Changed: " << MI << "\n");
     WorkList.insert(&MI);
+    // The change may have unlocked combines on the users of MI's results;
+    // revisiting them here means fewer full passes over the function are
+    // needed to reach the fixed point.
+    for (const MachineOperand &MO : MI.defs())
+      if (MO.getReg().isVirtual())
+        for (MachineInstr &UseMI : MRI.use_nodbg_instructions(MO.getReg()))
+          WorkList.insert(&UseMI);
   }
 
   void reportFullyCreatedInstrs() {
@@ -124,7 +133,7 @@ bool Combiner::combineMachineInstrs(MachineFunction &MF,
     // down RPOT.
     Changed = false;
     GISelWorkList<512> WorkList;
-    WorkListMaintainer Observer(WorkList);
+    WorkListMaintainer Observer(WorkList, *MRI);
     GISelObserverWrapper WrapperObserver(&Observer);
     if (CSEInfo)
       WrapperObserver.addObserver(CSEInfo);
@@ -111,11 +111,11 @@ const LiveInterval *LiveIntervalUnion::getOneVReg() const {
   return nullptr;
 }
 
-// Scan the vector of interfering virtual registers in this union. Assume it's
-// quite small.
+// Check the set of interfering virtual registers in this union. Kept as a set
+// because pressure-heavy functions can accumulate long interference lists.
 bool LiveIntervalUnion::Query::isSeenInterference(
     const LiveInterval *VirtReg) const {
-  return is_contained(InterferingVRegs, VirtReg);
+  return SeenVRegs.contains(VirtReg);
 }
 
 // Collect virtual registers in this union that interfere with this
@@ -158,7 +158,7 @@ LiveIntervalUnion::Query::collectInterferingVRegs(unsigned MaxInterferingRegs) {
     while (LRI->start < LiveUnionI.stop() && LRI->end > LiveUnionI.start()) {
       // This is an overlap, record the interfering register.
       const LiveInterval *VReg = LiveUnionI.value();
-      if (VReg != RecentReg && !isSeenInterference(VReg)) {
+      if (VReg != RecentReg && SeenVRegs.insert(VReg).second) {
         RecentReg = VReg;
         InterferingVRegs.push_back(VReg);
         if (InterferingVRegs.size() >= MaxInterferingRegs)
@@ -1886,6 +1886,11 @@ unsigned RAGreedy::tryLastChanceRecoloring(const LiveInterval &VirtReg,
   FixedRegisters.insert(VirtReg.reg());
   SmallVector<Register, 4> CurrentNewVRegs;
 
+  // Save the current recoloring state. Each failed attempt below restores
+  // FixedRegisters to this state, so one copy taken here serves every
+  // candidate physical register.
+  const SmallVirtRegSet SaveFixedRegisters(FixedRegisters);
+
   for (MCRegister PhysReg : Order) {
     assert(PhysReg.isValid());
     LLVM_DEBUG(dbgs() << "Try to assign: " << VirtReg << " to "
@@ -1932,10 +1937,8 @@ unsigned RAGreedy::tryLastChanceRecoloring(const LiveInterval &VirtReg,
     // available colors.
     Matrix->assign(VirtReg, PhysReg);
 
-    // Save the current recoloring state.
     // If we cannot recolor all the interferences, we will have to start again
     // at this point for the next physical register.
-    SmallVirtRegSet SaveFixedRegisters(FixedRegisters);
     if (tryRecoloringCandidates(RecoloringQueue, CurrentNewVRegs,
                                 FixedRegisters, RecolorStack, Depth)) {
       // Push the queued vregs into the main queue.
@@ -822,7 +822,7 @@ void ScheduleDAGInstrs::buildSchedGraph(AAResults *AA,
     if (MI.isDebugLabel() || MI.isDebugRef() || MI.isPseudoProbe())
       continue;
 
-    SUnit *SU = MISUnitMap[&MI];
+    SUnit *SU = MISUnitMap.lookup(&MI);
     assert(SU && "No SUnit mapped to this MI");
 
     if (RPTracker) {
@@ -1317,6 +1317,12 @@ void SelectionDAG::init(MachineFunction &NewMF,
                         UniformityInfo *NewUA, ProfileSummaryInfo *PSIin,
                         BlockFrequencyInfo *BFIin,
                         FunctionVarLocs const *VarLocs) {
+  // Reclaim operand memory from the previous function. clear() deliberately
+  // keeps the recycled operand arrays so that the per-block DAGs of one
+  // function do not repeatedly free and reallocate the same slabs.
+  OperandRecycler.clear(OperandAllocator);
+  OperandAllocator.Reset();
+
   MF = &NewMF;
   SDAGISelPass = PassPtr;
   ORE = &NewORE;
@@ -1394,8 +1400,9 @@ SDNode *SelectionDAG::FindNodeOrInsertPos(const FoldingSetNodeID &ID,
 
 void SelectionDAG::clear() {
   allnodes_clear();
-  OperandRecycler.clear(OperandAllocator);
-  OperandAllocator.Reset();
+  // Operand arrays were pushed onto OperandRecycler's free lists by
+  // allnodes_clear(); keep them (and the underlying slabs) for the next
+  // block's DAG. init() resets the allocator when moving to a new function.
   CSEMap.clear();
 
   ExtendedValueTypeNodes.clear();
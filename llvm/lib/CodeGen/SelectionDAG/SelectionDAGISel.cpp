@@ -2662,23 +2662,35 @@ CheckOpcode(const unsigned char *MatcherTable, unsigned &MatcherIndex,
 }
 
 LLVM_ATTRIBUTE_ALWAYS_INLINE static bool
-CheckType(const unsigned char *MatcherTable, unsigned &MatcherIndex, SDValue N,
-          const TargetLowering *TLI, const DataLayout &DL) {
-  MVT::SimpleValueType VT = (MVT::SimpleValueType)MatcherTable[MatcherIndex++];
+CheckType(MVT::SimpleValueType VT, SDValue N, const TargetLowering *TLI,
+          const DataLayout &DL) {
   if (N.getValueType() == VT) return true;
 
   // Handle the case when VT is iPTR.
   return VT == MVT::iPTR && N.getValueType() == TLI->getPointerTy(DL);
 }
 
+LLVM_ATTRIBUTE_ALWAYS_INLINE static bool
+CheckType(const unsigned char *MatcherTable, unsigned &MatcherIndex, SDValue N,
+          const TargetLowering *TLI, const DataLayout &DL) {
+  MVT::SimpleValueType VT = (MVT::SimpleValueType)MatcherTable[MatcherIndex++];
+  return ::CheckType(VT, N, TLI, DL);
+}
+
+LLVM_ATTRIBUTE_ALWAYS_INLINE static bool
+CheckChildType(MVT::SimpleValueType VT, SDValue N, const TargetLowering *TLI,
+               const DataLayout &DL, unsigned ChildNo) {
+  if (ChildNo >= N.getNumOperands())
+    return false;  // Match fails if out of range child #.
+  return ::CheckType(VT, N.getOperand(ChildNo), TLI, DL);
+}
+
 LLVM_ATTRIBUTE_ALWAYS_INLINE static bool
 CheckChildType(const unsigned char *MatcherTable, unsigned &MatcherIndex,
                SDValue N, const TargetLowering *TLI, const DataLayout &DL,
                unsigned ChildNo) {
-  if (ChildNo >= N.getNumOperands())
-    return false;  // Match fails if out of range child #.
-  return ::CheckType(MatcherTable, MatcherIndex, N.getOperand(ChildNo), TLI,
-                     DL);
+  MVT::SimpleValueType VT = (MVT::SimpleValueType)MatcherTable[MatcherIndex++];
+  return ::CheckChildType(VT, N, TLI, DL, ChildNo);
 }
 
 LLVM_ATTRIBUTE_ALWAYS_INLINE static bool
@@ -2806,6 +2818,14 @@ static unsigned IsPredicateKnownToFail(const unsigned char *Table,
     Result = !::CheckType(Table, Index, N, SDISel.TLI,
                           SDISel.CurDAG->getDataLayout());
     return Index;
+  case SelectionDAGISel::OPC_CheckTypeI32:
+    Result = !::CheckType(MVT::i32, N, SDISel.TLI,
+                          SDISel.CurDAG->getDataLayout());
+    return Index;
+  case SelectionDAGISel::OPC_CheckTypeI64:
+    Result = !::CheckType(MVT::i64, N, SDISel.TLI,
+                          SDISel.CurDAG->getDataLayout());
+    return Index;
   case SelectionDAGISel::OPC_CheckTypeRes: {
     unsigned Res = Table[Index++];
     Result = !::CheckType(Table, Index, N.getValue(Res), SDISel.TLI,
@@ -2824,6 +2844,30 @@ static unsigned IsPredicateKnownToFail(const unsigned char *Table,
                  Table, Index, N, SDISel.TLI, SDISel.CurDAG->getDataLayout(),
                  Table[Index - 1] - SelectionDAGISel::OPC_CheckChild0Type);
     return Index;
+  case SelectionDAGISel::OPC_CheckChild0TypeI32:
+  case SelectionDAGISel::OPC_CheckChild1TypeI32:
+  case SelectionDAGISel::OPC_CheckChild2TypeI32:
+  case SelectionDAGISel::OPC_CheckChild3TypeI32:
+  case SelectionDAGISel::OPC_CheckChild4TypeI32:
+  case SelectionDAGISel::OPC_CheckChild5TypeI32:
+  case SelectionDAGISel::OPC_CheckChild6TypeI32:
+  case SelectionDAGISel::OPC_CheckChild7TypeI32:
+    Result = !::CheckChildType(
+                 MVT::i32, N, SDISel.TLI, SDISel.CurDAG->getDataLayout(),
+                 Table[Index - 1] - SelectionDAGISel::OPC_CheckChild0TypeI32);
+    return Index;
+  case SelectionDAGISel::OPC_CheckChild0TypeI64:
+  case SelectionDAGISel::OPC_CheckChild1TypeI64:
+  case SelectionDAGISel::OPC_CheckChild2TypeI64:
+  case SelectionDAGISel::OPC_CheckChild3TypeI64:
+  case SelectionDAGISel::OPC_CheckChild4TypeI64:
+  case SelectionDAGISel::OPC_CheckChild5TypeI64:
+  case SelectionDAGISel::OPC_CheckChild6TypeI64:
+  case SelectionDAGISel::OPC_CheckChild7TypeI64:
+    Result = !::CheckChildType(
+                 MVT::i64, N, SDISel.TLI, SDISel.CurDAG->getDataLayout(),
+                 Table[Index - 1] - SelectionDAGISel::OPC_CheckChild0TypeI64);
+    return Index;
   case SelectionDAGISel::OPC_CheckCondCode:
     Result = !::CheckCondCode(Table, Index, N);
     return Index;
@@ -3254,6 +3298,16 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
         break;
       continue;
 
+    case OPC_CheckTypeI32:
+      if (!::CheckType(MVT::i32, N, TLI, CurDAG->getDataLayout()))
+        break;
+      continue;
+
+    case OPC_CheckTypeI64:
+      if (!::CheckType(MVT::i64, N, TLI, CurDAG->getDataLayout()))
+        break;
+      continue;
+
     case OPC_CheckTypeRes: {
       unsigned Res = MatcherTable[MatcherIndex++];
       if (!::CheckType(MatcherTable, MatcherIndex, N.getValue(Res), TLI,
@@ -3334,6 +3388,22 @@ void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
                             Opcode - OPC_CheckChild0Type))
         break;
       continue;
+    case OPC_CheckChild0TypeI32: case OPC_CheckChild1TypeI32:
+    case OPC_CheckChild2TypeI32: case OPC_CheckChild3TypeI32:
+    case OPC_CheckChild4TypeI32: case OPC_CheckChild5TypeI32:
+    case OPC_CheckChild6TypeI32: case OPC_CheckChild7TypeI32:
+      if (!::CheckChildType(MVT::i32, N, TLI, CurDAG->getDataLayout(),
+                            Opcode - OPC_CheckChild0TypeI32))
+        break;
+      continue;
+    case OPC_CheckChild0TypeI64: case OPC_CheckChild1TypeI64:
+    case OPC_CheckChild2TypeI64: case OPC_CheckChild3TypeI64:
+    case OPC_CheckChild4TypeI64: case OPC_CheckChild5TypeI64:
+    case OPC_CheckChild6TypeI64: case OPC_CheckChild7TypeI64:
+      if (!::CheckChildType(MVT::i64, N, TLI, CurDAG->getDataLayout(),
+                            Opcode - OPC_CheckChild0TypeI64))
+        break;
+      continue;
     case OPC_CheckCondCode:
       if (!::CheckCondCode(MatcherTable, MatcherIndex, N)) break;
       continue;
@@ -381,6 +381,7 @@ void DWARFUnit::clear() {
   SU = nullptr;
   clearDIEs(false);
   AddrDieMap.clear();
+  AddrDieRanges.clear();
   if (DWO)
     DWO->clear();
   DWO.reset();
@@ -750,16 +751,25 @@ void DWARFUnit::updateAddressDieMap(DWARFDie Die) {
 
 DWARFDie DWARFUnit::getSubroutineForAddress(uint64_t Address) {
   extractDIEsIfNeeded(false);
-  if (AddrDieMap.empty())
+  if (AddrDieRanges.empty()) {
+    // Populate the interim map, then flatten it into the sorted vector that
+    // serves all lookups and release the map's nodes.
     updateAddressDieMap(getUnitDIE());
-  auto R = AddrDieMap.upper_bound(Address);
-  if (R == AddrDieMap.begin())
+    AddrDieRanges.reserve(AddrDieMap.size());
+    for (const auto &E : AddrDieMap)
+      AddrDieRanges.push_back({E.first, E.second.first, E.second.second});
+    AddrDieMap.clear();
+  }
+  auto R = llvm::upper_bound(
+      AddrDieRanges, Address,
+      [](uint64_t LHS, const AddrDieRange &RHS) { return LHS < RHS.LowPC; });
+  if (R == AddrDieRanges.begin())
     return DWARFDie();
   // upper_bound's previous item contains Address.
   --R;
-  if (Address >= R->second.first)
+  if (Address >= R->HighPC)
     return DWARFDie();
-  return R->second.second;
+  return R->Die;
 }
 
 void DWARFUnit::updateVariableDieMap(DWARFDie Die) {
@@ -34,6 +34,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <numeric>
 
 namespace llvm {
 namespace codeview {
@@ -96,6 +97,69 @@ LLVMSymbolizer::symbolizeCode(ArrayRef<uint8_t> BuildID,
   return symbolizeCodeCommon(BuildID, ModuleOffset);
 }
 
+template <typename T>
+Expected<std::vector<DILineInfo>> LLVMSymbolizer::symbolizeCodeBatchCommon(
+    const T &ModuleSpecifier, ArrayRef<object::SectionedAddress> ModuleOffsets) {
+  std::vector<DILineInfo> Result(ModuleOffsets.size());
+  if (ModuleOffsets.empty())
+    return Result;
+
+  auto InfoOrErr = getOrCreateModuleInfo(ModuleSpecifier);
+  if (!InfoOrErr)
+    return InfoOrErr.takeError();
+
+  SymbolizableModule *Info = *InfoOrErr;
+
+  // A null module means an error has already been reported. Return empty
+  // results.
+  if (!Info)
+    return Result;
+
+  // Visit the addresses in ascending order so that consecutive queries tend
+  // to land in the same compile unit and reuse its cached DIE index and line
+  // table, while still writing results back in the caller's order.
+  SmallVector<unsigned, 0> Order(ModuleOffsets.size());
+  std::iota(Order.begin(), Order.end(), 0);
+  llvm::stable_sort(Order, [&](unsigned LHS, unsigned RHS) {
+    return std::tie(ModuleOffsets[LHS].SectionIndex,
+                    ModuleOffsets[LHS].Address) <
+           std::tie(ModuleOffsets[RHS].SectionIndex,
+                    ModuleOffsets[RHS].Address);
+  });
+
+  DILineInfoSpecifier Specifier(Opts.PathStyle, Opts.PrintFunctions);
+  for (unsigned I : Order) {
+    object::SectionedAddress ModuleOffset = ModuleOffsets[I];
+    if (Opts.RelativeAddresses)
+      ModuleOffset.Address += Info->getModulePreferredBase();
+
+    DILineInfo LineInfo =
+        Info->symbolizeCode(ModuleOffset, Specifier, Opts.UseSymbolTable);
+    if (Opts.Demangle)
+      LineInfo.FunctionName = DemangleName(LineInfo.FunctionName, Info);
+    Result[I] = std::move(LineInfo);
+  }
+  return Result;
+}
+
+Expected<std::vector<DILineInfo>>
+LLVMSymbolizer::symbolizeCode(const ObjectFile &Obj,
+                              ArrayRef<object::SectionedAddress> ModuleOffsets) {
+  return symbolizeCodeBatchCommon(Obj, ModuleOffsets);
+}
+
+Expected<std::vector<DILineInfo>>
+LLVMSymbolizer::symbolizeCode(const std::string &ModuleName,
+                              ArrayRef<object::SectionedAddress> ModuleOffsets) {
+  return symbolizeCodeBatchCommon(ModuleName, ModuleOffsets);
+}
+
+Expected<std::vector<DILineInfo>>
+LLVMSymbolizer::symbolizeCode(ArrayRef<uint8_t> BuildID,
+                              ArrayRef<object::SectionedAddress> ModuleOffsets) {
+  return symbolizeCodeBatchCommon(BuildID, ModuleOffsets);
+}
+
 template <typename T>
 Expected<DIInliningInfo> LLVMSymbolizer::symbolizeInlinedCodeCommon(
     const T &ModuleSpecifier, object::SectionedAddress ModuleOffset) {
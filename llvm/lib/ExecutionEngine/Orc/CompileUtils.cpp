@@ -87,6 +87,12 @@ ConcurrentIRCompiler::ConcurrentIRCompiler(JITTargetMachineBuilder JTMB,
 
 Expected<std::unique_ptr<MemoryBuffer>>
 ConcurrentIRCompiler::operator()(Module &M) {
+  // Probe the cache before building a TargetMachine: workloads that replay
+  // many cached modules at startup should not pay for target setup on hits.
+  if (ObjCache)
+    if (auto CachedObject = ObjCache->getObject(&M))
+      return std::move(CachedObject);
+
   auto TM = cantFail(JTMB.createTargetMachine());
   SimpleCompiler C(*TM, ObjCache);
   return C(M);
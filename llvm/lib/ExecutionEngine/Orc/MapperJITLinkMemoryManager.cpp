@@ -124,18 +124,29 @@ void MapperJITLinkMemoryManager::allocate(const JITLinkDylib *JD, LinkGraph &G,
 
   Mutex.lock();
 
-  // find an already reserved range that is large enough
+  // Find the smallest already reserved range that is large enough (best
+  // fit): with many dylibs created and destroyed over a session, first fit
+  // tends to shave pages off the large ranges and leave only fragments
+  // behind, forcing fresh reservations even though enough recycled memory
+  // is available in total.
   ExecutorAddrRange SelectedRange{};
+  AvailableMemoryMap::iterator SelectedIt = AvailableMemory.end();
 
   for (AvailableMemoryMap::iterator It = AvailableMemory.begin();
        It != AvailableMemory.end(); It++) {
-    if (It.stop() - It.start() + 1 >= TotalSize) {
+    ExecutorAddrDiff Size = It.stop() - It.start() + 1;
+    if (Size >= TotalSize &&
+        (SelectedRange.empty() || Size < SelectedRange.size())) {
       SelectedRange = ExecutorAddrRange(It.start(), It.stop() + 1);
-      It.erase();
-      break;
+      SelectedIt = It;
+      if (Size == TotalSize)
+        break;
     }
   }
 
+  if (SelectedIt != AvailableMemory.end())
+    SelectedIt.erase();
+
   if (SelectedRange.empty()) { // no already reserved range was found
     auto TotalAllocation = alignTo(TotalSize, ReservationUnits);
     Mapper->reserve(TotalAllocation, std::move(CompleteAllocation));
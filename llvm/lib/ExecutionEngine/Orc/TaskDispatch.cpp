@@ -27,20 +27,54 @@ void DynamicThreadPoolTaskDispatcher::dispatch(std::unique_ptr<Task> T) {
   {
     std::lock_guard<std::mutex> Lock(DispatchMutex);
     ++Outstanding;
+
+    // Hand the task to an idle worker if one is available: reusing a thread
+    // is much cheaper than spawning one, and dispatch is on the critical
+    // path of symbol lookup. Each queued task reserves exactly one idle
+    // thread, so a task can never sit in the queue behind a blocked worker.
+    if (IdleThreads > 0) {
+      --IdleThreads;
+      WorkQueue.push_back(std::move(T));
+      WorkAvailableCV.notify_one();
+      return;
+    }
   }
 
   std::thread([this, T = std::move(T)]() mutable {
-    T->run();
-    std::lock_guard<std::mutex> Lock(DispatchMutex);
-    --Outstanding;
-    OutstandingCV.notify_all();
+    while (true) {
+      T->run();
+
+      std::unique_lock<std::mutex> Lock(DispatchMutex);
+      --Outstanding;
+      OutstandingCV.notify_all();
+
+      // Stay alive and wait for more work rather than exiting, unless the
+      // session is shutting down.
+      ++IdleThreads;
+      WorkAvailableCV.wait(
+          Lock, [this]() { return !WorkQueue.empty() || !Running; });
+      if (!WorkQueue.empty()) {
+        // Our reservation was made by the dispatcher, which already
+        // decremented IdleThreads on our behalf.
+        T = std::move(WorkQueue.front());
+        WorkQueue.pop_front();
+        continue;
+      }
+
+      // Shutting down: unregister and let the thread exit.
+      --IdleThreads;
+      OutstandingCV.notify_all();
+      return;
+    }
   }).detach();
 }
 
 void DynamicThreadPoolTaskDispatcher::shutdown() {
   std::unique_lock<std::mutex> Lock(DispatchMutex);
   Running = false;
-  OutstandingCV.wait(Lock, [this]() { return Outstanding == 0; });
+  WorkAvailableCV.notify_all();
+  OutstandingCV.wait(
+      Lock, [this]() { return Outstanding == 0 && IdleThreads == 0; });
 }
 #endif
 
@@ -357,6 +357,18 @@ void LLVMContext::setDiscardValueNames(bool Discard) {
   pImpl->DiscardValueNames = Discard;
 }
 
+thread_local BumpPtrAllocator *llvm::IRArenaTLS = nullptr;
+
+void LLVMContext::setArenaAllocation(bool Enable) {
+  if (Enable && !pImpl->IRArena)
+    pImpl->IRArena = std::make_unique<BumpPtrAllocator>();
+  IRArenaTLS = Enable ? pImpl->IRArena.get() : nullptr;
+}
+
+bool LLVMContext::hasArenaAllocation() const {
+  return pImpl->IRArena != nullptr;
+}
+
 OptPassGate &LLVMContext::getOptPassGate() const {
   return pImpl->getOptPassGate();
 }
@@ -1530,6 +1530,11 @@ public:
   BumpPtrAllocator Alloc;
   UniqueStringSaver Saver{Alloc};
 
+  /// Arena backing User allocations when LLVMContext::setArenaAllocation is
+  /// enabled. Lazily created and never destroyed before the context itself so
+  /// arena-backed IR outlives any toggling of the mode.
+  std::unique_ptr<BumpPtrAllocator> IRArena;
+
   DenseMap<unsigned, IntegerType *> IntegerTypes;
 
   using FunctionTypeSet = DenseSet<FunctionType *, FunctionTypeKeyInfo>;
@@ -1635,6 +1640,11 @@ public:
   void setOptPassGate(OptPassGate &);
 };
 
+/// Arena installed for the calling thread by LLVMContext::setArenaAllocation.
+/// User's operator new implementations consult this because they have no
+/// other path to the owning context at allocation time.
+extern thread_local BumpPtrAllocator *IRArenaTLS;
+
 } // end namespace llvm
 
 #endif // LLVM_LIB_IR_LLVMCONTEXTIMPL_H
@@ -7,6 +7,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/IR/User.h"
+#include "LLVMContextImpl.h"
 #include "llvm/IR/Constant.h"
 #include "llvm/IR/GlobalValue.h"
 #include "llvm/IR/IntrinsicInst.h"
@@ -57,7 +58,12 @@ void User::allocHungoffUses(unsigned N, bool IsPhi) {
   size_t size = N * sizeof(Use);
   if (IsPhi)
     size += N * sizeof(BasicBlock *);
-  Use *Begin = static_cast<Use*>(::operator new(size));
+  // Keep the use list in the same arena as the object itself so teardown
+  // stays uniform (see User::operator delete).
+  void *Storage = HasArenaStorage
+                      ? getContext().pImpl->IRArena->Allocate(size, alignof(Use))
+                      : ::operator new(size);
+  Use *Begin = static_cast<Use *>(Storage);
   Use *End = Begin + N;
   setOperandList(Begin);
   for (; Begin != End; Begin++)
@@ -86,7 +92,8 @@ void User::growHungoffUses(unsigned NewNumUses, bool IsPhi) {
     auto *NewPtr = reinterpret_cast<char *>(NewOps + NewNumUses);
     std::copy(OldPtr, OldPtr + (OldNumUses * sizeof(BasicBlock *)), NewPtr);
   }
-  Use::zap(OldOps, OldOps + OldNumUses, true);
+  // Arena-backed use lists are reclaimed in bulk with the context.
+  Use::zap(OldOps, OldOps + OldNumUses, /* Delete */ !HasArenaStorage);
 }
 
 
@@ -131,14 +138,17 @@ void *User::allocateFixedOperandUser(size_t Size, unsigned Us,
   assert(DescBytesToAllocate % sizeof(void *) == 0 &&
          "We need this to satisfy alignment constraints for Uses");
 
+  size_t AllocSize = Size + sizeof(Use) * Us + DescBytesToAllocate;
   uint8_t *Storage = static_cast<uint8_t *>(
-      ::operator new(Size + sizeof(Use) * Us + DescBytesToAllocate));
+      IRArenaTLS ? IRArenaTLS->Allocate(AllocSize, alignof(Use))
+                 : ::operator new(AllocSize));
   Use *Start = reinterpret_cast<Use *>(Storage + DescBytesToAllocate);
   Use *End = Start + Us;
   User *Obj = reinterpret_cast<User*>(End);
   Obj->NumUserOperands = Us;
   Obj->HasHungOffUses = false;
   Obj->HasDescriptor = DescBytes != 0;
+  Obj->HasArenaStorage = IRArenaTLS != nullptr;
   for (; Start != End; Start++)
     new (Start) Use(Obj);
 
@@ -160,12 +170,15 @@ void *User::operator new(size_t Size, unsigned Us, unsigned DescBytes) {
 
 void *User::operator new(size_t Size) {
   // Allocate space for a single Use*
-  void *Storage = ::operator new(Size + sizeof(Use *));
+  void *Storage = IRArenaTLS
+                      ? IRArenaTLS->Allocate(Size + sizeof(Use *), alignof(Use *))
+                      : ::operator new(Size + sizeof(Use *));
   Use **HungOffOperandList = static_cast<Use **>(Storage);
   User *Obj = reinterpret_cast<User *>(HungOffOperandList + 1);
   Obj->NumUserOperands = 0;
   Obj->HasHungOffUses = true;
   Obj->HasDescriptor = false;
+  Obj->HasArenaStorage = IRArenaTLS != nullptr;
   *HungOffOperandList = nullptr;
   return Obj;
 }
@@ -180,26 +193,31 @@ LLVM_NO_SANITIZE_MEMORY_ATTRIBUTE void User::operator delete(void *Usr) {
   // Hung off uses use a single Use* before the User, while other subclasses
   // use a Use[] allocated prior to the user.
   User *Obj = static_cast<User *>(Usr);
+  // Arena-backed objects (and their use lists) become tombstones here; the
+  // memory is reclaimed in bulk when the owning LLVMContext is destroyed.
   if (Obj->HasHungOffUses) {
     assert(!Obj->HasDescriptor && "not supported!");
 
     Use **HungOffOperandList = static_cast<Use **>(Usr) - 1;
     // drop the hung off uses.
     Use::zap(*HungOffOperandList, *HungOffOperandList + Obj->NumUserOperands,
-             /* Delete */ true);
-    ::operator delete(HungOffOperandList);
+             /* Delete */ !Obj->HasArenaStorage);
+    if (!Obj->HasArenaStorage)
+      ::operator delete(HungOffOperandList);
   } else if (Obj->HasDescriptor) {
     Use *UseBegin = static_cast<Use *>(Usr) - Obj->NumUserOperands;
     Use::zap(UseBegin, UseBegin + Obj->NumUserOperands, /* Delete */ false);
 
     auto *DI = reinterpret_cast<DescriptorInfo *>(UseBegin) - 1;
     uint8_t *Storage = reinterpret_cast<uint8_t *>(DI) - DI->SizeInBytes;
-    ::operator delete(Storage);
+    if (!Obj->HasArenaStorage)
+      ::operator delete(Storage);
   } else {
     Use *Storage = static_cast<Use *>(Usr) - Obj->NumUserOperands;
     Use::zap(Storage, Storage + Obj->NumUserOperands,
              /* Delete */ false);
-    ::operator delete(Storage);
+    if (!Obj->HasArenaStorage)
+      ::operator delete(Storage);
   }
 }
 
@@ -979,8 +979,9 @@ Error LTO::linkRegularLTO(RegularLTOState::AddedModule Mod,
     if (LivenessFromIndex && !ThinLTO.CombinedIndex.isGUIDLive(GV->getGUID())) {
       if (Function *F = dyn_cast<Function>(GV)) {
         if (DiagnosticOutputFile) {
-          if (Error Err = F->materialize())
-            return Err;
+          // The function is about to be dropped; emit the remark on the
+          // still-unmaterialized declaration rather than deserializing a body
+          // that would be discarded immediately afterwards.
           OptimizationRemarkEmitter ORE(F, nullptr);
           ORE.emit(OptimizationRemark(DEBUG_TYPE, "deadfunction", F)
                    << ore::NV("Function", F)
@@ -1713,8 +1714,11 @@ Error LTO::runThinLTO(AddStreamFn AddStream, FileCache Cache,
   runWholeProgramDevirtOnIndex(ThinLTO.CombinedIndex, ExportedGUIDs,
                                LocalWPDTargetsMap);
 
+  // This callback is invoked concurrently from the ComputeCrossModuleImport
+  // worker threads; use a non-mutating lookup (operator[] would insert and
+  // potentially rehash on a GUID with no resolution recorded).
   auto isPrevailing = [&](GlobalValue::GUID GUID, const GlobalValueSummary *S) {
-    return ThinLTO.PrevailingModuleForGUID[GUID] == S->modulePath();
+    return ThinLTO.PrevailingModuleForGUID.lookup(GUID) == S->modulePath();
   };
   if (EnableMemProfContextDisambiguation) {
     MemProfContextDisambiguation ContextDisambiguation;
@@ -276,11 +276,17 @@ MCSymbol *MCContext::createSymbol(StringRef Name, bool AlwaysAddSuffix,
 
   SmallString<128> NewName = Name;
   bool AddSuffix = AlwaysAddSuffix;
-  unsigned &NextUniqueID = NextID[Name];
+  // Only materialize a NextID entry once a suffix is actually needed; most
+  // symbols are created exactly once with their plain name, and eagerly
+  // creating the entry would hash the name a third time and grow the map by
+  // one entry per symbol.
+  unsigned *NextUniqueID = nullptr;
   while (true) {
     if (AddSuffix) {
+      if (!NextUniqueID)
+        NextUniqueID = &NextID[Name];
       NewName.resize(Name.size());
-      raw_svector_ostream(NewName) << NextUniqueID++;
+      raw_svector_ostream(NewName) << (*NextUniqueID)++;
     }
     auto NameEntry = UsedNames.insert(std::make_pair(NewName.str(), true));
     if (NameEntry.second || !NameEntry.first->second) {
@@ -550,6 +550,31 @@ static void CheckBundleSubtargets(const MCSubtargetInfo *OldSTI,
 void MCELFStreamer::emitInstToData(const MCInst &Inst,
                                    const MCSubtargetInfo &STI) {
   MCAssembler &Assembler = getAssembler();
+
+  // If bundling is disabled, encode the instruction directly into the current
+  // data fragment (or a new such fragment if the current fragment is not a
+  // data fragment, or the Subtarget has changed), sparing the copy through a
+  // temporary buffer. Code emitters produce fixup offsets relative to the
+  // start of the instruction, so they only need rebasing on the fragment
+  // offset.
+  if (!Assembler.isBundlingEnabled()) {
+    MCDataFragment *DF = getOrCreateDataFragment(&STI);
+    SmallVector<MCFixup, 4> Fixups;
+    size_t CodeOffset = DF->getContents().size();
+    Assembler.getEmitter().encodeInstruction(Inst, DF->getContents(), Fixups,
+                                             STI);
+    for (MCFixup &Fixup : Fixups) {
+      fixSymbolsInTLSFixups(Fixup.getValue());
+      Fixup.setOffset(Fixup.getOffset() + CodeOffset);
+      DF->getFixups().push_back(Fixup);
+    }
+    DF->setHasInstructions(STI);
+    if (!Fixups.empty() && Fixups.back().getTargetKind() ==
+                               Assembler.getBackend().RelaxFixupKind)
+      DF->setLinkerRelaxable();
+    return;
+  }
+
   SmallVector<MCFixup, 4> Fixups;
   SmallString<256> Code;
   Assembler.getEmitter().encodeInstruction(Inst, Code, Fixups, STI);
@@ -557,13 +582,7 @@ void MCELFStreamer::emitInstToData(const MCInst &Inst,
   for (auto &Fixup : Fixups)
     fixSymbolsInTLSFixups(Fixup.getValue());
 
-  // There are several possibilities here:
-  //
-  // If bundling is disabled, append the encoded instruction to the current data
-  // fragment (or create a new such fragment if the current fragment is not a
-  // data fragment, or the Subtarget has changed).
-  //
-  // If bundling is enabled:
+  // Since bundling is enabled:
   // - If we're not in a bundle-locked group, emit the instruction into a
   //   fragment of its own. If there are no fixups registered for the
   //   instruction, emit a MCCompactEncodedInstFragment. Otherwise, emit a
@@ -574,7 +593,7 @@ void MCELFStreamer::emitInstToData(const MCInst &Inst,
   //   the group, though.
   MCDataFragment *DF;
 
-  if (Assembler.isBundlingEnabled()) {
+  {
     MCSection &Sec = *getCurrentSectionOnly();
     if (Assembler.getRelaxAll() && isBundleLocked()) {
       // If the -mc-relax-all flag is used and we are bundle-locked, we re-use
@@ -617,8 +636,6 @@ void MCELFStreamer::emitInstToData(const MCInst &Inst,
     // We're now emitting an instruction in a bundle group, so this flag has
     // to be turned off.
     Sec.setBundleGroupBeforeFirstInst(false);
-  } else {
-    DF = getOrCreateDataFragment(&STI);
   }
 
   // Add the fixups and data.
@@ -633,11 +650,9 @@ void MCELFStreamer::emitInstToData(const MCInst &Inst,
     DF->setLinkerRelaxable();
   DF->getContents().append(Code.begin(), Code.end());
 
-  if (Assembler.isBundlingEnabled() && Assembler.getRelaxAll()) {
-    if (!isBundleLocked()) {
-      mergeFragment(getOrCreateDataFragment(&STI), DF);
-      delete DF;
-    }
+  if (Assembler.getRelaxAll() && !isBundleLocked()) {
+    mergeFragment(getOrCreateDataFragment(&STI), DF);
+    delete DF;
   }
 }
 
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <system_error>
@@ -814,10 +815,16 @@ data_type InstrProfLookupTrait::ReadData(StringRef K, const unsigned char *D,
     if (D + CountsSize * sizeof(uint64_t) > End)
       return data_type();
 
-    CounterBuffer.clear();
-    CounterBuffer.reserve(CountsSize);
-    for (uint64_t J = 0; J < CountsSize; ++J)
-      CounterBuffer.push_back(endian::readNext<uint64_t, little, unaligned>(D));
+    CounterBuffer.resize(CountsSize);
+    if (sys::IsLittleEndianHost) {
+      // Counters are stored little-endian; on matching hosts copy the whole
+      // array at once instead of assembling each value byte by byte.
+      memcpy(CounterBuffer.data(), D, CountsSize * sizeof(uint64_t));
+      D += CountsSize * sizeof(uint64_t);
+    } else {
+      for (uint64_t J = 0; J < CountsSize; ++J)
+        CounterBuffer[J] = endian::readNext<uint64_t, little, unaligned>(D);
+    }
 
     DataBuffer.emplace_back(K, Hash, std::move(CounterBuffer));
 
@@ -348,9 +348,18 @@ void InstrProfWriter::addTemporalProfileTraces(
 
 void InstrProfWriter::mergeRecordsFromWriter(InstrProfWriter &&IPW,
                                              function_ref<void(Error)> Warn) {
-  for (auto &I : IPW.FunctionData)
+  for (auto &I : IPW.FunctionData) {
+    // Steal the whole per-function table when this writer has not seen the
+    // name yet; going through addRecord record by record only pays off when
+    // both writers have data for the function to merge.
+    auto [Where, Inserted] = FunctionData.try_emplace(I.getKey());
+    if (Inserted) {
+      Where->second = std::move(I.getValue());
+      continue;
+    }
     for (auto &Func : I.getValue())
       addRecord(I.getKey(), Func.first, std::move(Func.second), 1, Warn);
+  }
 
   BinaryIds.reserve(BinaryIds.size() + IPW.BinaryIds.size());
   for (auto &I : IPW.BinaryIds)
@@ -2525,11 +2525,20 @@ int APInt::tcMultiplyPart(WordType *dst, const WordType *src,
     //   (n - 1) * (n - 1) + 2 (n - 1) = (n - 1) * (n + 1)
     // which is less than n^2.
     WordType srcPart = src[i];
-    WordType low, mid, high;
+    WordType low, high;
     if (multiplier == 0 || srcPart == 0) {
       low = carry;
       high = 0;
     } else {
+#if defined(__SIZEOF_INT128__) ||                                              \
+    (defined(_INTEGRAL_MAX_BITS) && _INTEGRAL_MAX_BITS >= 128)
+      // Let the compiler emit a single widening multiply; the carry addition
+      // cannot overflow 128 bits per the bound above.
+      __uint128_t product = (__uint128_t)srcPart * multiplier + carry;
+      low = WordType(product);
+      high = WordType(product >> APINT_BITS_PER_WORD);
+#else
+      WordType mid;
       low = lowHalf(srcPart) * lowHalf(multiplier);
       high = highHalf(srcPart) * highHalf(multiplier);
 
@@ -2551,6 +2560,7 @@ int APInt::tcMultiplyPart(WordType *dst, const WordType *src,
       if (low + carry < low)
         high++;
       low += carry;
+#endif
     }
 
     if (add) {
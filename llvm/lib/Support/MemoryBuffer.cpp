@@ -238,6 +238,8 @@ public:
   }
 
   void dontNeedIfMmap() override { MFR.dontNeed(); }
+
+  void willNeedIfMmap() override { MFR.willNeed(); }
 };
 } // namespace
 
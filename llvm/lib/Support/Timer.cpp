@@ -36,6 +36,12 @@
 #include <libproc.h>
 #endif
 
+#if defined(__linux__) && HAVE_UNISTD_H
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
 using namespace llvm;
 
 // This ugly hack is brought to you courtesy of constructor/destructor ordering
@@ -161,6 +167,25 @@ static uint64_t getCurInstructionsExecuted() {
   if (proc_pid_rusage(getpid(), RUSAGE_INFO_V4, (rusage_info_t *)&ru) == 0) {
     return ru.ri_instructions;
   }
+#elif defined(__linux__) && HAVE_UNISTD_H
+  // Count retired user-space instructions of the calling thread with a
+  // perf event opened once on first use. If the kernel refuses the event
+  // (perf_event_paranoid, seccomp, missing PMU), keep reporting zero.
+  static int EventFD = [] {
+    struct perf_event_attr Attr;
+    memset(&Attr, 0, sizeof(Attr));
+    Attr.type = PERF_TYPE_HARDWARE;
+    Attr.size = sizeof(Attr);
+    Attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    Attr.exclude_kernel = 1;
+    Attr.exclude_hv = 1;
+    return static_cast<int>(
+        syscall(SYS_perf_event_open, &Attr, /*pid=*/0, /*cpu=*/-1,
+                /*group_fd=*/-1, /*flags=*/0));
+  }();
+  uint64_t Count;
+  if (EventFD != -1 && read(EventFD, &Count, sizeof(Count)) == sizeof(Count))
+    return Count;
 #endif
   return 0;
 }
@@ -6865,6 +6865,23 @@ struct AAHeapToStackFunction final : public AAHeapToStack {
               A.getAssumedConstant(*V, AA, UsedAssumedInformation))
         if (*SimpleV)
           return *SimpleV;
+      // The operand may take one of several known values, e.g., a size
+      // selected by a phi. An unsigned upper bound over all potential
+      // constants is still a valid allocation size, so use the maximum.
+      if (V->getType()->isIntegerTy()) {
+        auto *PotentialConstantsAA = A.getAAFor<AAPotentialConstantValues>(
+            AA, IRPosition::value(*V), DepClassTy::OPTIONAL);
+        if (PotentialConstantsAA && PotentialConstantsAA->isValidState() &&
+            !PotentialConstantsAA->undefIsContained() &&
+            !PotentialConstantsAA->getAssumedSet().empty()) {
+          const auto &AssumedSet = PotentialConstantsAA->getAssumedSet();
+          APInt Max = *AssumedSet.begin();
+          for (const APInt &Candidate : AssumedSet)
+            if (Candidate.ugt(Max))
+              Max = Candidate;
+          return ConstantInt::get(V->getType(), Max);
+        }
+      }
       return V;
     };
 
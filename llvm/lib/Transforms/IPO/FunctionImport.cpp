@@ -39,11 +39,13 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/IPO/Internalize.h"
 #include "llvm/Transforms/Utils/Cloning.h"
 #include "llvm/Transforms/Utils/FunctionImportUtils.h"
 #include "llvm/Transforms/Utils/ValueMapper.h"
+#include <atomic>
 #include <cassert>
 #include <memory>
 #include <set>
@@ -139,6 +141,11 @@ static cl::opt<bool>
     ImportAllIndex("import-all-index",
                    cl::desc("Import all external functions in index."));
 
+static cl::opt<unsigned> ImportComputeThreads(
+    "import-compute-threads", cl::init(0), cl::Hidden,
+    cl::desc("Number of threads used to compute cross-module imports (0 means "
+             "all hardware threads, 1 disables parallelism)"));
+
 // Load lazily a module from \p FileName in \p Context.
 static std::unique_ptr<Module> loadFile(const std::string &FileName,
                                         LLVMContext &Context) {
@@ -717,13 +724,56 @@ void llvm::ComputeCrossModuleImport(
         isPrevailing,
     DenseMap<StringRef, FunctionImporter::ImportMapTy> &ImportLists,
     DenseMap<StringRef, FunctionImporter::ExportSetTy> &ExportLists) {
-  // For each module that has function defined, compute the import/export lists.
+  // For each module that has function defined, compute the import/export
+  // lists. The combined index is read-only at this point, so the modules can
+  // be processed concurrently; each worker accumulates the exports it
+  // discovers into a private shard that is merged below, and the per-module
+  // import lists are pre-created so the map is never mutated concurrently.
+  SmallVector<StringRef, 0> ModuleNames;
+  ModuleNames.reserve(ModuleToDefinedGVSummaries.size());
   for (const auto &DefinedGVSummaries : ModuleToDefinedGVSummaries) {
-    auto &ImportList = ImportLists[DefinedGVSummaries.first];
-    LLVM_DEBUG(dbgs() << "Computing import for Module '"
-                      << DefinedGVSummaries.first << "'\n");
-    ComputeImportForModule(DefinedGVSummaries.second, isPrevailing, Index,
-                           DefinedGVSummaries.first, ImportList, &ExportLists);
+    ModuleNames.push_back(DefinedGVSummaries.first);
+    (void)ImportLists[DefinedGVSummaries.first];
+  }
+
+  unsigned NumWorkers = ImportComputeThreads
+                            ? ImportComputeThreads
+                            : hardware_concurrency().compute_thread_count();
+  NumWorkers = std::min<unsigned>(NumWorkers, ModuleNames.size());
+
+  if (NumWorkers <= 1) {
+    for (StringRef ModName : ModuleNames) {
+      LLVM_DEBUG(dbgs() << "Computing import for Module '" << ModName
+                        << "'\n");
+      ComputeImportForModule(ModuleToDefinedGVSummaries.find(ModName)->second,
+                             isPrevailing, Index, ModName,
+                             ImportLists.find(ModName)->second, &ExportLists);
+    }
+  } else {
+    std::vector<DenseMap<StringRef, FunctionImporter::ExportSetTy>>
+        ExportShards(NumWorkers);
+    std::atomic<size_t> NextModule(0);
+    ThreadPool Pool(hardware_concurrency(NumWorkers));
+    for (unsigned I = 0; I != NumWorkers; ++I) {
+      Pool.async([&, I] {
+        size_t Idx;
+        while ((Idx = NextModule.fetch_add(1, std::memory_order_relaxed)) <
+               ModuleNames.size()) {
+          StringRef ModName = ModuleNames[Idx];
+          ComputeImportForModule(
+              ModuleToDefinedGVSummaries.find(ModName)->second, isPrevailing,
+              Index, ModName, ImportLists.find(ModName)->second,
+              &ExportShards[I]);
+        }
+      });
+    }
+    Pool.wait();
+    // Union the per-worker export shards. The per-module results are sets, so
+    // the import and export lists end up identical to a serial computation
+    // regardless of how modules were distributed over workers.
+    for (auto &Shard : ExportShards)
+      for (auto &ELI : Shard)
+        ExportLists[ELI.first].insert(ELI.second.begin(), ELI.second.end());
   }
 
   // When computing imports we only added the variables and functions being
@@ -25,8 +25,10 @@
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/Analysis/BlockFrequencyInfo.h"
 #include "llvm/Analysis/GlobalsModRef.h"
 #include "llvm/Analysis/MemoryBuiltins.h"
+#include "llvm/Analysis/ProfileSummaryInfo.h"
 #include "llvm/Analysis/StackSafetyAnalysis.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
 #include "llvm/Analysis/ValueTracking.h"
@@ -329,6 +331,13 @@ static cl::opt<int> ClInstrumentationWithCallsThreshold(
         "inline checks (-1 means never use callbacks)."),
     cl::Hidden, cl::init(7000));
 
+static cl::opt<bool> ClInstrumentationWithCallsForCold(
+    "asan-instrumentation-with-calls-for-cold",
+    cl::desc("Use callbacks instead of inline checks in functions that "
+             "profile data identifies as cold, trading a slower check for "
+             "smaller code."),
+    cl::Hidden, cl::init(false));
+
 static cl::opt<std::string> ClMemoryAccessCallbackPrefix(
     "asan-memory-access-callback-prefix",
     cl::desc("Prefix for memory access callbacks"), cl::Hidden,
@@ -711,7 +720,8 @@ struct AddressSanitizer {
   void instrumentMemIntrinsic(MemIntrinsic *MI);
   Value *memToShadow(Value *Shadow, IRBuilder<> &IRB);
   bool suppressInstrumentationSiteForDebug(int &Instrumented);
-  bool instrumentFunction(Function &F, const TargetLibraryInfo *TLI);
+  bool instrumentFunction(Function &F, const TargetLibraryInfo *TLI,
+                          bool FunctionIsCold = false);
   bool maybeInsertAsanInitAtFunctionEntry(Function &F);
   bool maybeInsertDynamicShadowAtFunctionEntry(Function &F);
   void markEscapedLocalAllocas(Function &F);
@@ -1160,12 +1170,20 @@ PreservedAnalyses AddressSanitizerPass::run(Module &M,
   auto &FAM = MAM.getResult<FunctionAnalysisManagerModuleProxy>(M).getManager();
   const StackSafetyGlobalInfo *const SSGI =
       ClUseStackSafety ? &MAM.getResult<StackSafetyGlobalAnalysis>(M) : nullptr;
+  ProfileSummaryInfo *PSI = &MAM.getResult<ProfileSummaryAnalysis>(M);
+  if (!PSI->hasProfileSummary())
+    PSI = nullptr;
   for (Function &F : M) {
     AddressSanitizer FunctionSanitizer(M, SSGI, Options.CompileKernel,
                                        Options.Recover, Options.UseAfterScope,
                                        Options.UseAfterReturn);
     const TargetLibraryInfo &TLI = FAM.getResult<TargetLibraryAnalysis>(F);
-    Modified |= FunctionSanitizer.instrumentFunction(F, &TLI);
+    bool FunctionIsCold = false;
+    if (ClInstrumentationWithCallsForCold && PSI && !F.isDeclaration()) {
+      BlockFrequencyInfo &BFI = FAM.getResult<BlockFrequencyAnalysis>(F);
+      FunctionIsCold = PSI->isFunctionColdInCallGraph(&F, BFI);
+    }
+    Modified |= FunctionSanitizer.instrumentFunction(F, &TLI, FunctionIsCold);
   }
   Modified |= ModuleSanitizer.instrumentModule(M);
   if (!Modified)
@@ -2794,7 +2812,8 @@ bool AddressSanitizer::suppressInstrumentationSiteForDebug(int &Instrumented) {
 }
 
 bool AddressSanitizer::instrumentFunction(Function &F,
-                                          const TargetLibraryInfo *TLI) {
+                                          const TargetLibraryInfo *TLI,
+                                          bool FunctionIsCold) {
   if (F.empty())
     return false;
   if (F.getLinkage() == GlobalValue::AvailableExternallyLinkage) return false;
@@ -2892,7 +2911,8 @@ bool AddressSanitizer::instrumentFunction(Function &F,
 
   bool UseCalls = (ClInstrumentationWithCallsThreshold >= 0 &&
                    OperandsToInstrument.size() + IntrinToInstrument.size() >
-                       (unsigned)ClInstrumentationWithCallsThreshold);
+                       (unsigned)ClInstrumentationWithCallsThreshold) ||
+                  FunctionIsCold;
   const DataLayout &DL = F.getParent()->getDataLayout();
   ObjectSizeOpts ObjSizeOpts;
   ObjSizeOpts.RoundToAlign = true;
@@ -577,7 +577,7 @@ bool JumpThreadingPass::computeValueKnownInPredecessorsImpl(
 
   // If V is a constant, then it is known in all predecessors.
   if (Constant *KC = getKnownConstant(V, Preference)) {
-    for (BasicBlock *Pred : predecessors(BB))
+    for (BasicBlock *Pred : BlockPredsCache.get(BB))
       Result.emplace_back(KC, Pred);
 
     return !Result.empty();
@@ -590,7 +590,7 @@ bool JumpThreadingPass::computeValueKnownInPredecessorsImpl(
 
     // Okay, if this is a live-in value, see if it has a known value at the any
     // edge from our predecessors.
-    for (BasicBlock *P : predecessors(BB)) {
+    for (BasicBlock *P : BlockPredsCache.get(BB)) {
       using namespace PatternMatch;
       // If the value is known by LazyValueInfo to be a constant in a
       // predecessor, use that information to try to thread this block.
@@ -804,7 +804,7 @@ bool JumpThreadingPass::computeValueKnownInPredecessorsImpl(
 
       if (!isa<Instruction>(CmpLHS) ||
           cast<Instruction>(CmpLHS)->getParent() != BB) {
-        for (BasicBlock *P : predecessors(BB)) {
+        for (BasicBlock *P : BlockPredsCache.get(BB)) {
           // If the value is known by LazyValueInfo to be a constant in a
           // predecessor, use that information to try to thread this block.
           LazyValueInfo::Tristate Res =
@@ -832,7 +832,7 @@ bool JumpThreadingPass::computeValueKnownInPredecessorsImpl(
             match(CmpLHS, m_Add(m_Value(AddLHS), m_ConstantInt(AddConst)))) {
           if (!isa<Instruction>(AddLHS) ||
               cast<Instruction>(AddLHS)->getParent() != BB) {
-            for (BasicBlock *P : predecessors(BB)) {
+            for (BasicBlock *P : BlockPredsCache.get(BB)) {
               // If the value is known by LazyValueInfo to be a ConstantRange in
               // a predecessor, use that information to try to thread this
               // block.
@@ -28,6 +28,7 @@
 #include "llvm/Analysis/CFG.h"
 #include "llvm/Analysis/DomTreeUpdater.h"
 #include "llvm/Analysis/GlobalsModRef.h"
+#include "llvm/Analysis/PostDominators.h"
 #include "llvm/Analysis/TargetTransformInfo.h"
 #include "llvm/IR/Attributes.h"
 #include "llvm/IR/CFG.h"
@@ -263,14 +264,11 @@ static bool iterativelySimplifyCFG(Function &F, const TargetTransformInfo &TTI,
 }
 
 static bool simplifyFunctionCFGImpl(Function &F, const TargetTransformInfo &TTI,
-                                    DominatorTree *DT,
+                                    DomTreeUpdater *DTU,
                                     const SimplifyCFGOptions &Options) {
-  DomTreeUpdater DTU(DT, DomTreeUpdater::UpdateStrategy::Eager);
-
-  bool EverChanged = removeUnreachableBlocks(F, DT ? &DTU : nullptr);
-  EverChanged |=
-      tailMergeBlocksWithSimilarFunctionTerminators(F, DT ? &DTU : nullptr);
-  EverChanged |= iterativelySimplifyCFG(F, TTI, DT ? &DTU : nullptr, Options);
+  bool EverChanged = removeUnreachableBlocks(F, DTU);
+  EverChanged |= tailMergeBlocksWithSimilarFunctionTerminators(F, DTU);
+  EverChanged |= iterativelySimplifyCFG(F, TTI, DTU, Options);
 
   // If neither pass changed anything, we're done.
   if (!EverChanged) return false;
@@ -280,25 +278,32 @@ static bool simplifyFunctionCFGImpl(Function &F, const TargetTransformInfo &TTI,
   // iterate between the two optimizations.  We structure the code like this to
   // avoid rerunning iterativelySimplifyCFG if the second pass of
   // removeUnreachableBlocks doesn't do anything.
-  if (!removeUnreachableBlocks(F, DT ? &DTU : nullptr))
+  if (!removeUnreachableBlocks(F, DTU))
     return true;
 
   do {
-    EverChanged = iterativelySimplifyCFG(F, TTI, DT ? &DTU : nullptr, Options);
-    EverChanged |= removeUnreachableBlocks(F, DT ? &DTU : nullptr);
+    EverChanged = iterativelySimplifyCFG(F, TTI, DTU, Options);
+    EverChanged |= removeUnreachableBlocks(F, DTU);
   } while (EverChanged);
 
   return true;
 }
 
 static bool simplifyFunctionCFG(Function &F, const TargetTransformInfo &TTI,
-                                DominatorTree *DT,
+                                DominatorTree *DT, PostDominatorTree *PDT,
                                 const SimplifyCFGOptions &Options) {
   assert((!RequireAndPreserveDomTree ||
           (DT && DT->verify(DominatorTree::VerificationLevel::Full))) &&
          "Original domtree is invalid?");
 
-  bool Changed = simplifyFunctionCFGImpl(F, TTI, DT, Options);
+  // Batch CFG updates through the lazy strategy so that long runs of local
+  // simplifications are folded into a handful of incremental applications
+  // instead of one eager recalculation per update, and so that an already
+  // computed (post-)dominator tree survives the pass.
+  DomTreeUpdater DTU(DT, PDT, DomTreeUpdater::UpdateStrategy::Lazy);
+  bool Changed =
+      simplifyFunctionCFGImpl(F, TTI, DT || PDT ? &DTU : nullptr, Options);
+  DTU.flush();
 
   assert((!RequireAndPreserveDomTree ||
           (DT && DT->verify(DominatorTree::VerificationLevel::Full))) &&
@@ -360,11 +365,19 @@ PreservedAnalyses SimplifyCFGPass::run(Function &F,
   DominatorTree *DT = nullptr;
   if (RequireAndPreserveDomTree)
     DT = &AM.getResult<DominatorTreeAnalysis>(F);
-  if (!simplifyFunctionCFG(F, TTI, DT, Options))
+  else
+    // Even when nothing downstream demands a dominator tree, keep an already
+    // computed one up to date incrementally rather than forcing a full
+    // recomputation after the pass.
+    DT = AM.getCachedResult<DominatorTreeAnalysis>(F);
+  PostDominatorTree *PDT = AM.getCachedResult<PostDominatorTreeAnalysis>(F);
+  if (!simplifyFunctionCFG(F, TTI, DT, PDT, Options))
     return PreservedAnalyses::all();
   PreservedAnalyses PA;
-  if (RequireAndPreserveDomTree)
+  if (DT)
     PA.preserve<DominatorTreeAnalysis>();
+  if (PDT)
+    PA.preserve<PostDominatorTreeAnalysis>();
   return PA;
 }
 
@@ -394,7 +407,7 @@ struct CFGSimplifyPass : public FunctionPass {
       DT = &getAnalysis<DominatorTreeWrapperPass>().getDomTree();
 
     auto &TTI = getAnalysis<TargetTransformInfoWrapperPass>().getTTI(F);
-    return simplifyFunctionCFG(F, TTI, DT, Options);
+    return simplifyFunctionCFG(F, TTI, DT, /*PDT=*/nullptr, Options);
   }
   void getAnalysisUsage(AnalysisUsage &AU) const override {
     AU.addRequired<AssumptionCacheTracker>();
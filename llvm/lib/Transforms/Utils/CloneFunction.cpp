@@ -92,6 +92,12 @@ void llvm::CloneFunctionInto(Function *NewFunc, const Function *OldFunc,
                              ValueMaterializer *Materializer) {
   assert(NameSuffix && "NameSuffix cannot be null!");
 
+  // Nearly every value in OldFunc gets a map entry during cloning; presizing
+  // here avoids growing and rehashing the map once per doubling while the
+  // body is copied.
+  VMap.reserve(VMap.size() + OldFunc->getInstructionCount() +
+               OldFunc->arg_size() + OldFunc->size());
+
 #ifndef NDEBUG
   for (const Argument &I : OldFunc->args())
     assert(VMap.count(&I) && "No mapping from source argument specified!");
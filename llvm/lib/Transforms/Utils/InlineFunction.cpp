@@ -2082,6 +2082,11 @@ llvm::InlineResult llvm::InlineFunction(CallBase &CB, InlineFunctionInfo &IFI,
 
   { // Scope to destroy VMap after cloning.
     ValueToValueMapTy VMap;
+    // The map will hold an entry for roughly every value cloned out of the
+    // callee; presize it so inlining large callees does not repeatedly grow
+    // and rehash the underlying DenseMap.
+    VMap.reserve(CalledFunc->getInstructionCount() +
+                 CalledFunc->arg_size() + CalledFunc->size());
     struct ByValInit {
       Value *Dst;
       Value *Src;
@@ -1626,6 +1626,9 @@ public:
     WideningDecisions.clear();
     Uniforms.clear();
     Scalars.clear();
+    // Memoized per-(instruction, VF) costs were computed against the decisions
+    // dropped above and must not survive them.
+    CostMemo.clear();
   }
 
   /// The vectorization cost is a combination of the cost itself and a boolean
@@ -1756,6 +1759,14 @@ private:
   /// vectorization factor. The entries are VF-ScalarCostTy pairs.
   DenseMap<ElementCount, ScalarCostsTy> InstsToScalarize;
 
+  /// Memoized per-(instruction, VF) costs, valid once the per-VF analysis
+  /// state (widening decisions, uniforms/scalars, scalarization costs) has
+  /// been computed. expectedCost is evaluated for the same VF several times
+  /// during factor and interleave-count selection; caching here avoids
+  /// re-issuing the underlying TTI queries for every repetition.
+  DenseMap<std::pair<Instruction *, ElementCount>, VectorizationCostTy>
+      CostMemo;
+
   /// Holds the instructions known to be uniform after vectorization.
   /// The data is collected per VF.
   DenseMap<ElementCount, SmallPtrSet<Instruction *, 4>> Uniforms;
@@ -6371,7 +6382,12 @@ LoopVectorizationCostModel::expectedCost(
           (VF.isVector() && VecValuesToIgnore.count(&I)))
         continue;
 
-      VectorizationCostTy C = getInstructionCost(&I, VF);
+      VectorizationCostTy C;
+      auto [MemoIter, MemoInserted] = CostMemo.try_emplace({&I, VF});
+      if (MemoInserted)
+        MemoIter->second = C = getInstructionCost(&I, VF);
+      else
+        C = MemoIter->second;
 
       // Check if we should override the cost.
       if (C.first.isValid() &&
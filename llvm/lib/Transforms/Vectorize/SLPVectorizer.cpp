@@ -2372,6 +2372,18 @@ public:
   void clearReductionData() {
     AnalyzedReductionsRoots.clear();
     AnalyzedReductionVals.clear();
+    AnalyzedBundleVals.clear();
+  }
+  /// Checks if the provided candidate bundle was already analyzed and found
+  /// not profitable to vectorize (in the current state of the function).
+  bool areAnalyzedBundleVals(ArrayRef<Value *> VL) const {
+    return AnalyzedBundleVals.contains(hash_value(VL));
+  }
+  /// Adds the candidate bundle to the list of already analyzed bundles. The
+  /// list is dropped whenever a tree is vectorized, since that may change the
+  /// profitability of previously rejected bundles.
+  void analyzedBundleVals(ArrayRef<Value *> VL) {
+    AnalyzedBundleVals.insert(hash_value(VL));
   }
   /// Checks if the given value is gathered in one of the nodes.
   bool isAnyGathered(const SmallDenseSet<Value *> &Vals) const {
@@ -3037,6 +3049,9 @@ private:
   /// Set of hashes for the list of reduction values already being analyzed.
   DenseSet<size_t> AnalyzedReductionVals;
 
+  /// Set of hashes of candidate bundles that were analyzed and rejected.
+  DenseSet<size_t> AnalyzedBundleVals;
+
   /// A list of values that need to extracted out of the tree.
   /// This list holds pairs of (Internal Scalar : External User). External User
   /// can be nullptr, it means that this Internal Scalar will be used later,
@@ -10843,6 +10858,10 @@ Value *BoUpSLP::vectorizeTree(
     const ExtraValueToDebugLocsMap &ExternallyUsedValues,
     SmallVectorImpl<std::pair<Value *, Value *>> &ReplacedExternals,
     Instruction *ReductionRoot) {
+  // Vectorizing this tree changes the costs of bundles rejected earlier, so
+  // let them be analyzed again.
+  AnalyzedBundleVals.clear();
+
   // All blocks must be scheduled before any instructions are inserted.
   for (auto &BSIter : BlocksSchedules) {
     scheduleBlock(BSIter.second.get());
@@ -12753,6 +12772,12 @@ bool SLPVectorizerPass::tryToVectorizeList(ArrayRef<Value *> VL, BoUpSLP &R,
           }))
         continue;
 
+      // Skip bundles that were analyzed and rejected already, unless
+      // something was vectorized in between.
+      if (R.areAnalyzedBundleVals(Ops))
+        continue;
+      R.analyzedBundleVals(Ops);
+
       LLVM_DEBUG(dbgs() << "SLP: Analyzing " << ActualVF << " operations "
                         << "\n");
 
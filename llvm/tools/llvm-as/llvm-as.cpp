@@ -23,6 +23,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/Signals.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/SystemUtils.h"
 #include "llvm/Support/ToolOutputFile.h"
@@ -80,6 +81,50 @@ static void WriteOutputFile(const Module *M, const ModuleSummaryIndex *Index) {
     }
   }
 
+  auto WriteTo = [&](raw_ostream &OS) {
+    if (Force || !CheckBitcodeOutputToConsole(OS)) {
+      const ModuleSummaryIndex *IndexToWrite = nullptr;
+      // Don't attempt to write a summary index unless it contains any entries
+      // or has non-zero flags. The latter is used to assemble dummy index
+      // files for skipping modules by distributed ThinLTO backends. Otherwise
+      // we get an empty summary section.
+      if (Index && (Index->begin() != Index->end() || Index->getFlags()))
+        IndexToWrite = Index;
+      if (!IndexToWrite || (M && (!M->empty() || !M->global_empty())))
+        // If we have a non-empty Module, then we write the Module plus
+        // any non-null Index along with it as a per-module Index.
+        // If both are empty, this will give an empty module block, which is
+        // the expected behavior.
+        WriteBitcodeToFile(*M, OS, PreserveBitcodeUseListOrder, IndexToWrite,
+                           EmitModuleHash);
+      else
+        // Otherwise, with an empty Module but non-empty Index, we write a
+        // combined index.
+        writeIndexToFile(*IndexToWrite, OS);
+    }
+  };
+
+  // When the output is a regular file, write through a raw_fd_stream so the
+  // bitcode writer can flush finished blocks incrementally and backpatch
+  // block sizes in place (see -bitcode-flush-threshold) instead of buffering
+  // the whole module in memory before the first byte hits disk.
+  if (OutputFilename != "-") {
+    std::error_code EC;
+    raw_fd_stream OS(OutputFilename, EC);
+    if (!EC) {
+      sys::RemoveFileOnSignal(OutputFilename);
+      WriteTo(OS);
+      OS.close();
+      if (OS.has_error()) {
+        errs() << "error writing '" << OutputFilename
+               << "': " << OS.error().message() << '\n';
+        exit(1);
+      }
+      sys::DontRemoveFileOnSignal(OutputFilename);
+      return;
+    }
+  }
+
   std::error_code EC;
   std::unique_ptr<ToolOutputFile> Out(
       new ToolOutputFile(OutputFilename, EC, sys::fs::OF_None));
@@ -88,26 +133,7 @@ static void WriteOutputFile(const Module *M, const ModuleSummaryIndex *Index) {
     exit(1);
   }
 
-  if (Force || !CheckBitcodeOutputToConsole(Out->os())) {
-    const ModuleSummaryIndex *IndexToWrite = nullptr;
-    // Don't attempt to write a summary index unless it contains any entries or
-    // has non-zero flags. The latter is used to assemble dummy index files for
-    // skipping modules by distributed ThinLTO backends. Otherwise we get an empty
-    // summary section.
-    if (Index && (Index->begin() != Index->end() || Index->getFlags()))
-      IndexToWrite = Index;
-    if (!IndexToWrite || (M && (!M->empty() || !M->global_empty())))
-      // If we have a non-empty Module, then we write the Module plus
-      // any non-null Index along with it as a per-module Index.
-      // If both are empty, this will give an empty module block, which is
-      // the expected behavior.
-      WriteBitcodeToFile(*M, Out->os(), PreserveBitcodeUseListOrder,
-                         IndexToWrite, EmitModuleHash);
-    else
-      // Otherwise, with an empty Module but non-empty Index, we write a
-      // combined index.
-      writeIndexToFile(*IndexToWrite, Out->os());
-  }
+  WriteTo(Out->os());
 
   // Declare success.
   Out->keep();
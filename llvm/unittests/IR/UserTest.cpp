@@ -176,4 +176,58 @@ TEST(UserTest, PersonalityUser) {
   EXPECT_TRUE(TestF->user_empty());
 }
 
+TEST(UserTest, ArenaAllocation) {
+  LLVMContext C;
+  EXPECT_FALSE(C.hasArenaAllocation());
+  C.setArenaAllocation(true);
+  EXPECT_TRUE(C.hasArenaAllocation());
+
+  Module M("", C);
+  IntegerType *Int32Ty = Type::getInt32Ty(C);
+  FunctionType *FTy =
+      FunctionType::get(Int32Ty, {Int32Ty, Int32Ty}, /*isVarArg=*/false);
+  Function *F = Function::Create(FTy, GlobalValue::ExternalLinkage, "f", &M);
+  Argument *X = F->getArg(0), *Y = F->getArg(1);
+  BasicBlock *BB = BasicBlock::Create(C, "entry", F);
+
+  // Fixed-operand path: the use list is co-allocated with the instruction in
+  // the arena; deleting the instruction must not try to free it.
+  BinaryOperator *Add = BinaryOperator::CreateAdd(X, Y, "add", BB);
+  EXPECT_EQ(Add->getOperand(0), X);
+  EXPECT_EQ(Add->getOperand(1), Y);
+  BinaryOperator *Dead = BinaryOperator::CreateAdd(X, Y, "dead");
+  Dead->deleteValue();
+  EXPECT_TRUE(X->hasOneUse());
+
+  // Hung-off path: the PHI's use list is a separate arena allocation, and
+  // growing past the reserved space reallocates it in the arena without
+  // freeing the old list.
+  PHINode *PN = PHINode::Create(Int32Ty, /*NumReservedValues=*/1);
+  for (unsigned I = 0; I != 8; ++I)
+    PN->addIncoming(Add, BB);
+  EXPECT_EQ(PN->getNumIncomingValues(), 8u);
+  PN->deleteValue();
+  EXPECT_TRUE(Add->use_empty());
+
+  // Descriptor path: operand bundles store their tags in descriptor bytes
+  // allocated in front of the use list.
+  Function *Callee =
+      Function::Create(FTy, GlobalValue::ExternalLinkage, "g", &M);
+  OperandBundleDef Bundle("tag", std::vector<Value *>{X});
+  CallInst *Call = CallInst::Create(FTy, Callee, {X, Y}, {Bundle});
+  EXPECT_EQ(Call->getNumOperandBundles(), 1u);
+  EXPECT_EQ(Call->getOperandBundleAt(0).getTagName(), "tag");
+  Call->deleteValue();
+
+  // Turning the mode off only affects subsequent allocations; IR created
+  // while it was on stays arena-backed until the context dies.
+  C.setArenaAllocation(false);
+  EXPECT_TRUE(C.hasArenaAllocation());
+  BinaryOperator *HeapAdd = BinaryOperator::CreateAdd(X, Y, "heap");
+  HeapAdd->deleteValue();
+
+  // The remaining arena-backed IR (F, BB, Add) is torn down with the module
+  // and context; the arena reclaims the storage in bulk.
+}
+
 } // end anonymous namespace
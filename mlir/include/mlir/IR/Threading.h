@@ -19,8 +19,11 @@
 
 #include "mlir/IR/Diagnostics.h"
 #include "llvm/ADT/Sequence.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/ThreadPool.h"
 #include <atomic>
+#include <iterator>
+#include <type_traits>
 
 namespace mlir {
 
@@ -48,6 +51,20 @@ LogicalResult failableParallelForEach(MLIRContext *context, IteratorT begin,
     return success();
   }
 
+  // Workers fetch elements by index below, which requires random access to
+  // stay linear overall. For other iterator categories (e.g. the op list of a
+  // block), materialize the iterators once and process the resulting vector.
+  if constexpr (!std::is_base_of_v<
+                    std::random_access_iterator_tag,
+                    typename std::iterator_traits<IteratorT>::iterator_category>) {
+    SmallVector<IteratorT> iterators;
+    iterators.reserve(numElements);
+    for (IteratorT it = begin; it != end; ++it)
+      iterators.push_back(it);
+    return failableParallelForEach(context, iterators.begin(), iterators.end(),
+                                   [&](IteratorT &it) { return func(*it); });
+  }
+
   // Build a wrapper processing function that properly initializes a parallel
   // diagnostic handler.
   ParallelDiagnosticHandler handler(context);
@@ -795,9 +795,10 @@ wouldCreateWriteToNonWritableBuffer(OpOperand &operand,
 // Find the values that define the contents of the given value.
 const llvm::SetVector<Value> &
 OneShotAnalysisState::findDefinitionsCached(Value value) {
-  if (!cachedDefinitions.count(value))
-    cachedDefinitions[value] = findDefinitions(value);
-  return cachedDefinitions[value];
+  auto it = cachedDefinitions.find(value);
+  if (it == cachedDefinitions.end())
+    it = cachedDefinitions.try_emplace(value, findDefinitions(value)).first;
+  return it->second;
 }
 
 void OneShotAnalysisState::resetCache() {
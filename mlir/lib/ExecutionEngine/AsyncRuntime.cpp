@@ -33,6 +33,9 @@ using namespace mlir::runtime;
 
 namespace mlir {
 namespace runtime {
+// Forward declare the async token defined below.
+struct AsyncToken;
+
 namespace {
 
 // Forward declare class defined below.
@@ -49,6 +52,7 @@ public:
 
   ~AsyncRuntime() {
     threadPool.wait(); // wait for the completion of all async tasks
+    drainTokenPool();
     assert(getNumRefCountedObjects() == 0 &&
            "all ref counted objects must be destroyed");
   }
@@ -59,9 +63,19 @@ public:
 
   llvm::ThreadPool &getThreadPool() { return threadPool; }
 
+  // Async tokens are fixed-size and churn at a rate of one per task, so
+  // instead of returning them to the heap they are recycled through a free
+  // list. Returns nullptr if the pool is empty.
+  AsyncToken *takePooledToken();
+  void returnTokenToPool(AsyncToken *token);
+
 private:
   friend class RefCounted;
 
+  // Deletes all tokens held by the pool; called before the liveness check in
+  // the destructor, as pooled tokens still count as live objects.
+  void drainTokenPool();
+
   // Count the total number of reference counted objects in this instance
   // of an AsyncRuntime. For debugging purposes only.
   void addNumRefCountedObjects() {
@@ -73,6 +87,10 @@ private:
 
   std::atomic<int64_t> numRefCountedObjects;
   llvm::ThreadPool threadPool;
+
+  // Free list of recycled async tokens.
+  std::mutex tokenPoolMu;
+  std::vector<AsyncToken *> tokenPool;
 };
 
 // -------------------------------------------------------------------------- //
@@ -146,6 +164,15 @@ public:
 protected:
   virtual void destroy() { delete this; }
 
+  AsyncRuntime *getRuntime() const { return runtime; }
+
+  // Re-arm the reference count of a recycled object before it is handed out
+  // again. Must only be called on objects whose count has dropped to zero.
+  void resetRefCount(int64_t count) {
+    assert(refCount.load() == 0 && "can only reset destroyed objects");
+    refCount.store(count);
+  }
+
 private:
   AsyncRuntime *runtime;
   std::atomic<int64_t> refCount;
@@ -177,14 +204,55 @@ struct AsyncToken : public RefCounted {
   AsyncToken(AsyncRuntime *runtime)
       : RefCounted(runtime, /*refCount=*/2), state(State::kUnavailable) {}
 
+  // Reset a recycled token to its freshly-constructed state.
+  void reuse() {
+    resetRefCount(/*count=*/2);
+    state = State::kUnavailable;
+  }
+
   std::atomic<State::StateEnum> state;
 
   // Pending awaiters are guarded by a mutex.
   std::mutex mu;
   std::condition_variable cv;
   std::vector<std::function<void()>> awaiters;
+
+protected:
+  // Recycle the token through the runtime pool instead of deleting it. The
+  // already-executed awaiters are dropped here so that their closures are
+  // released promptly; the vector keeps its capacity for the next task.
+  void destroy() override {
+    awaiters.clear();
+    getRuntime()->returnTokenToPool(this);
+  }
 };
 
+AsyncToken *AsyncRuntime::takePooledToken() {
+  AsyncToken *token = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tokenPoolMu);
+    if (!tokenPool.empty()) {
+      token = tokenPool.back();
+      tokenPool.pop_back();
+    }
+  }
+  if (token)
+    token->reuse();
+  return token;
+}
+
+void AsyncRuntime::returnTokenToPool(AsyncToken *token) {
+  std::lock_guard<std::mutex> lock(tokenPoolMu);
+  tokenPool.push_back(token);
+}
+
+void AsyncRuntime::drainTokenPool() {
+  std::lock_guard<std::mutex> lock(tokenPoolMu);
+  for (AsyncToken *token : tokenPool)
+    delete token;
+  tokenPool.clear();
+}
+
 // Async value provides a mechanism to access the result of asynchronous
 // operations. It owns the storage that is used to store/load the value of the
 // underlying type, and a flag to signal if the value is ready or not.
@@ -236,8 +304,10 @@ extern "C" void mlirAsyncRuntimeDropRef(RefCountedObjPtr ptr, int64_t count) {
 
 // Creates a new `async.token` in not-ready state.
 extern "C" AsyncToken *mlirAsyncRuntimeCreateToken() {
-  AsyncToken *token = new AsyncToken(getDefaultAsyncRuntime());
-  return token;
+  AsyncRuntime *runtime = getDefaultAsyncRuntime();
+  if (AsyncToken *token = runtime->takePooledToken())
+    return token;
+  return new AsyncToken(runtime);
 }
 
 // Creates a new `async.value` in not-ready state.
@@ -45,27 +45,36 @@ void __kmp_print_structure(void); // Forward declaration
 // Compute how many threads to have polling each cache-line.
 // We want to limit the number of writes to IDEAL_GO_RESOLUTION.
 void distributedBarrier::computeVarsForN(size_t n) {
-  int nsockets = 1;
+  int nclusters = 1;
   if (__kmp_topology) {
     int socket_level = __kmp_topology->get_level(KMP_HW_SOCKET);
     int core_level = __kmp_topology->get_level(KMP_HW_CORE);
-    int ncores_per_socket =
-        __kmp_topology->calculate_ratio(core_level, socket_level);
-    nsockets = __kmp_topology->get_count(socket_level);
-
-    if (nsockets <= 0)
-      nsockets = 1;
-    if (ncores_per_socket <= 0)
-      ncores_per_socket = 1;
-
-    threads_per_go = ncores_per_socket >> 1;
+    // Group threads by last-level cache rather than by socket when the
+    // detected topology distinguishes the two: on chiplet-based systems
+    // several LLCs share a socket and polling a go-flag across LLCs is
+    // nearly as expensive as polling across sockets.
+    int cluster_level = __kmp_topology->get_level(KMP_HW_LLC);
+    if (cluster_level < 0)
+      cluster_level = __kmp_topology->get_level(KMP_HW_L3);
+    if (cluster_level < 0)
+      cluster_level = socket_level;
+    int ncores_per_cluster =
+        __kmp_topology->calculate_ratio(core_level, cluster_level);
+    nclusters = __kmp_topology->get_count(cluster_level);
+
+    if (nclusters <= 0)
+      nclusters = 1;
+    if (ncores_per_cluster <= 0)
+      ncores_per_cluster = 1;
+
+    threads_per_go = ncores_per_cluster >> 1;
     if (!fix_threads_per_go) {
       // Minimize num_gos
       if (threads_per_go > 4) {
         if (KMP_OPTIMIZE_FOR_REDUCTIONS) {
           threads_per_go = threads_per_go >> 1;
         }
-        if (threads_per_go > 4 && nsockets == 1)
+        if (threads_per_go > 4 && nclusters == 1)
           threads_per_go = threads_per_go >> 1;
       }
     }
@@ -75,11 +84,11 @@ void distributedBarrier::computeVarsForN(size_t n) {
     num_gos = n / threads_per_go;
     if (n % threads_per_go)
       num_gos++;
-    if (nsockets == 1 || num_gos == 1)
+    if (nclusters == 1 || num_gos == 1)
       num_groups = 1;
     else {
-      num_groups = num_gos / nsockets;
-      if (num_gos % nsockets)
+      num_groups = num_gos / nclusters;
+      if (num_gos % nclusters)
         num_groups++;
     }
     if (num_groups <= 0)